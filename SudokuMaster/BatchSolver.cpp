@@ -0,0 +1,222 @@
+#include "BatchSolver.h"
+#include "SudokuConstraints.h"
+#include "SudokuSolver.h"
+#include "BitboardSolver.h"
+#include "ParallelSolver.h"
+#include "ThreadHelper.h"
+#include <fstream>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+
+BatchSolver::BatchSolver(unsigned threadCount, EngineType engine)
+{
+	this->threadCount = ThreadHelper::resolveThreadCount(threadCount);
+
+	for (unsigned i = 0; i < this->threadCount; i++) {
+		if (engine == EngineType::bitboard)
+			workers.push_back(make_unique<BitboardSolver>());
+		else if (engine == EngineType::parallelAlgorithmX)
+			workers.push_back(make_unique<ParallelSolver>(1));
+		else
+			workers.push_back(make_unique<SudokuSolver>());
+	}
+}
+
+BatchSolver::Statistics BatchSolver::run(istream& input, ostream& output)
+{
+	Statistics stats;
+	vector<double> latencies;
+	auto start = chrono::steady_clock::now();
+
+	vector<Job> jobs;
+	jobs.reserve(chunkSize);
+	string line;
+	bool moreInput = true;
+
+	while (moreInput) {
+		//Read in the next chunk of puzzles
+		jobs.clear();
+		while (jobs.size() < chunkSize) {
+			if (!getline(input, line)) {
+				moreInput = false;
+				break;
+			}
+			if (!line.empty() && line.back() == '\r')
+				line.pop_back();
+			if (line.empty() || line[0] == '#')
+				continue;
+
+			Job job;
+			job.status = parse(line, job.puzzle) ? Status::none : Status::invalid;
+			job.microseconds = 0;
+			jobs.push_back(move(job));
+		}
+
+		solveChunk(jobs);
+
+		//Write the results out in the order they came in
+		for (const Job& job : jobs) {
+			writeJob(job, output);
+
+			stats.puzzles++;
+			switch (job.status) {
+			case Status::unique: stats.unique++; break;
+			case Status::multiple: stats.multiple++; break;
+			case Status::none: stats.none++; break;
+			case Status::invalid: stats.invalid++; continue;
+			}
+			latencies.push_back(job.microseconds);
+		}
+	}
+
+	stats.totalSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	if (!latencies.empty()) {
+		double total = 0;
+		for (double latency : latencies) {
+			total += latency;
+		}
+		stats.meanMicroseconds = total / latencies.size();
+
+		sort(latencies.begin(), latencies.end());
+		stats.medianMicroseconds = latencies[latencies.size() / 2];
+		stats.p99Microseconds = latencies[min(latencies.size() - 1, latencies.size() * 99 / 100)];
+		stats.maxMicroseconds = latencies.back();
+	}
+
+	return stats;
+}
+
+void BatchSolver::printStatistics(const Statistics& stats, ostream& output)
+{
+	output << "Puzzles:    " << stats.puzzles << "\n";
+	output << "  unique:   " << stats.unique << "\n";
+	output << "  multiple: " << stats.multiple << "\n";
+	output << "  none:     " << stats.none << "\n";
+	output << "  invalid:  " << stats.invalid << "\n";
+	output << "Time:       " << stats.totalSeconds << " s\n";
+	output << "Throughput: " << (stats.totalSeconds > 0 ? stats.puzzles / stats.totalSeconds : 0) << " puzzles/s\n";
+	output << "Latency:    mean " << stats.meanMicroseconds << " us, median " << stats.medianMicroseconds
+		<< " us, p99 " << stats.p99Microseconds << " us, max " << stats.maxMicroseconds << " us\n";
+}
+
+int BatchSolver::runCommand(const vector<string>& args, EngineType engine, const string& usage)
+{
+	if (args.size() < 2) {
+		cerr << "Usage: " << usage << "\n";
+		return 1;
+	}
+
+	ifstream input(args[0]);
+	if (!input) {
+		cerr << "Could not open " << args[0] << "\n";
+		return 1;
+	}
+
+	ofstream output(args[1]);
+	if (!output) {
+		cerr << "Could not open " << args[1] << "\n";
+		return 1;
+	}
+
+	//No thread count means one per hardware thread
+	unsigned threads = 0;
+	if (args.size() >= 3 && !ThreadHelper::parseThreadCount(args[2], threads)) {
+		cerr << "Not a thread count: " << args[2] << "\n";
+		cerr << "Usage: " << usage << "\n";
+		return 1;
+	}
+	BatchSolver batchSolver(threads, engine);
+	Statistics stats = batchSolver.run(input, output);
+	printStatistics(stats, cerr);
+
+	return 0;
+}
+
+bool BatchSolver::parse(const string& line, vector<vector<int>>& puzzle, string* error)
+{
+	const int size = SudokuConstraints::size;
+
+	//Allow trailing whitespace, but nothing else besides the 81 cells
+	size_t end = line.find_last_not_of(" \t");
+	size_t length = end == string::npos ? 0 : end + 1;
+	if (length != SudokuConstraints::cellCount) {
+		if (error)
+			*error = "expected " + to_string(SudokuConstraints::cellCount) + " cells but got " + to_string(length);
+		return false;
+	}
+
+	puzzle.assign(size, vector<int>(size));
+	for (int cell = 0; cell < SudokuConstraints::cellCount; cell++) {
+		char c = line[cell];
+		if (c == '.')
+			c = '0';
+		if (c < '0' || c > '9') {
+			if (error)
+				*error = string("'") + c + "' in cell " + to_string(cell + 1) + " (row " + to_string(cell / size + 1) + ", column " +
+					to_string(cell % size + 1) + ") isn't 0-9 or .";
+			return false;
+		}
+		puzzle[cell / size][cell % size] = c - '0';
+	}
+
+	return true;
+}
+
+void BatchSolver::solveChunk(vector<Job>& jobs)
+{
+	atomic<size_t> nextJob(0);
+
+	auto work = [&](SolverEngine& worker) {
+		SolutionStore solutions;
+		//Keep taking the next puzzle nobody has started on until there are none left
+		for (size_t i = nextJob++; i < jobs.size(); i = nextJob++) {
+			Job& job = jobs[i];
+			if (job.status == Status::invalid)
+				continue;
+
+			auto start = chrono::steady_clock::now();
+			//Two solutions are enough to tell unique from multiple
+			solutions.clear();
+			long long count = worker.solve(job.puzzle, solutions, 2).solutionCount;
+			job.microseconds = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+
+			if (count == 0) {
+				job.status = Status::none;
+				continue;
+			}
+			job.status = count == 1 ? Status::unique : Status::multiple;
+			job.solution = solutions.board(0);
+		}
+	};
+
+	//There is no point in starting more threads than there are puzzles
+	size_t threadsUsed = min((size_t)threadCount, jobs.size());
+	ThreadHelper::runOnThreads(threadsUsed, [&](size_t index) { work(*workers[index]); });
+}
+
+void BatchSolver::writeJob(const Job& job, ostream& output)
+{
+	switch (job.status) {
+	case Status::unique:
+		output << "unique ";
+		break;
+	case Status::multiple:
+		output << "multiple ";
+		break;
+	case Status::none:
+		output << "none\n";
+		return;
+	case Status::invalid:
+		output << "invalid\n";
+		return;
+	}
+
+	string cells(SudokuConstraints::cellCount, '0');
+	for (int cell = 0; cell < SudokuConstraints::cellCount; cell++) {
+		cells[cell] += job.solution[cell / SudokuConstraints::size][cell % SudokuConstraints::size];
+	}
+	output << cells << "\n";
+}
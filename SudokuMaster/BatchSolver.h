@@ -0,0 +1,79 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <iostream>
+#include <memory>
+#include "SolverEngine.h"
+
+using namespace std;
+
+//Solves whole files of puzzles without the GUI, spread over a number of worker threads.
+//The input has one puzzle per line as 81 characters, row by row, with 0 or . for an empty cell.
+//Blank lines and lines starting with # are skipped.
+//Every puzzle gets one output line, in the same order as the input:
+//   unique <solution>     the puzzle has exactly one solution
+//   multiple <solution>   the puzzle has more than one, the first one found is written
+//   none                  the puzzle has no solutions
+//   invalid               the line isn't a puzzle
+class BatchSolver
+{
+public:
+	//A thread count of 0 uses one thread per hardware thread. Every thread gets its own solver of the given engine,
+	//the parallel engine only solves on the thread it is called from here, since the puzzles are already spread over the threads.
+	BatchSolver(unsigned threadCount = 0, EngineType engine = EngineType::algorithmX);
+
+	struct Statistics
+	{
+		long long puzzles = 0;
+		long long unique = 0;
+		long long multiple = 0;
+		long long none = 0;
+		long long invalid = 0;
+
+		//Wall clock time of the whole run
+		double totalSeconds = 0;
+
+		//Time taken to solve a single puzzle
+		double meanMicroseconds = 0;
+		double medianMicroseconds = 0;
+		double p99Microseconds = 0;
+		double maxMicroseconds = 0;
+	};
+
+	//Solves every puzzle of input and writes the results to output
+	Statistics run(istream& input, ostream& output);
+
+	//Writes the statistics of a run in a human readable form
+	static void printStatistics(const Statistics& stats, ostream& output);
+
+	//The batch command of both sudoku-cli and the SudokuMaster binary: <input> <output> [threads], solved with the engine.
+	//args are the arguments after the command, usage is printed if they are wrong. Returns the exit code.
+	static int runCommand(const vector<string>& args, EngineType engine, const string& usage);
+
+	//Turns a line into a puzzle. Returns false if it isn't one, and if error is given says what is wrong with it there.
+	static bool parse(const string& line, vector<vector<int>>& puzzle, string* error = nullptr);
+
+private:
+	unsigned threadCount;
+
+	//One solver per worker thread
+	vector<unique_ptr<SolverEngine>> workers;
+
+	//How many puzzles are read in and solved at a time, so huge files don't have to fit in memory
+	static constexpr size_t chunkSize = 1 << 16;
+
+	enum class Status { unique, multiple, none, invalid };
+
+	struct Job
+	{
+		vector<vector<int>> puzzle;
+		Status status;
+		vector<vector<int>> solution;
+		double microseconds;
+	};
+
+	//Solves every job of the chunk on the worker threads
+	void solveChunk(vector<Job>& jobs);
+
+	static void writeJob(const Job& job, ostream& output);
+};
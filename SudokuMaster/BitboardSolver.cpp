@@ -0,0 +1,265 @@
+#include "BitboardSolver.h"
+#include "ExactCover/BitHelper.h"
+
+BitboardSolver::BitboardSolver()
+{
+	//Every row, column and outer square as a list of its cells
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++) {
+			units[i][j] = i * size + j;
+			units[size + i][j] = j * size + i;
+			units[size * 2 + i][j] = SudokuConstraints::tables.boxCells[i][j];
+		}
+	}
+
+	for (int cell = 0; cell < cellCount; cell++) {
+		cellRow[cell] = cell / size;
+		cellCol[cell] = cell % size;
+		cellBox[cell] = SudokuConstraints::boxOf(cell / size, cell % size);
+	}
+
+	solutions = nullptr;
+	maxSolutions = 0;
+	showProgress = false;
+	result = { 0, false };
+}
+
+BitboardSolver::SearchResult BitboardSolver::solve(const vector<vector<int>>& puzzle, SolutionStore& solutions, long long maxSolutions, bool showProgress)
+{
+	return search(puzzle, &solutions, maxSolutions, showProgress);
+}
+
+BitboardSolver::SearchResult BitboardSolver::countSolutions(const vector<vector<int>>& puzzle, long long maxSolutions)
+{
+	return search(puzzle, nullptr, maxSolutions, false);
+}
+
+BitboardSolver::SearchResult BitboardSolver::search(const vector<vector<int>>& puzzle, SolutionStore* solutions, long long maxSolutions, bool showProgress)
+{
+	this->solutions = solutions;
+	this->maxSolutions = maxSolutions;
+	this->showProgress = showProgress;
+	result = { 0, false };
+
+	//If the givens clash, there are no solutions
+	if (!load(puzzle))
+		return result;
+
+	int remaining = 0;
+	for (int cell = 0; cell < cellCount; cell++) {
+		if (board[cell] == 0)
+			emptyCells[remaining++] = cell;
+	}
+
+	fill(remaining);
+
+	this->solutions = nullptr;
+	return result;
+}
+
+bool BitboardSolver::load(const vector<vector<int>>& puzzle)
+{
+	for (int i = 0; i < size; i++) {
+		rowUsed[i] = 0;
+		colUsed[i] = 0;
+		boxUsed[i] = 0;
+	}
+
+	for (int row = 0; row < size; row++) {
+		for (int col = 0; col < size; col++) {
+			int cell = row * size + col;
+			int num = puzzle[row][col];
+			board[cell] = 0;
+			if (num == 0)
+				continue;
+
+			//The number has to still be a candidate, otherwise it repeats in the row, column or outer square
+			if (!(candidates(cell) & (1 << (num - 1))))
+				return false;
+			place(cell, num);
+		}
+	}
+
+	return true;
+}
+
+bool BitboardSolver::fill(int remaining)
+{
+	//Every cell is filled, so this is a solution
+	if (remaining == 0) {
+		if (solutions)
+			solutions->add(toBoard());
+		result.solutionCount++;
+
+		if (maxSolutions > 0 && result.solutionCount >= maxSolutions) {
+			result.limitReached = true;
+			return false;
+		}
+		return true;
+	}
+
+	//Work out the candidates of every empty cell, filled cells have none.
+	//At the same time find the most constrained cell. A cell with no candidates means this branch is dead.
+	uint16_t cellCandidates[cellCount] = {};
+	int bestCell = 0;
+	int bestCount = size + 1;
+	for (int i = 0; i < remaining; i++) {
+		uint8_t cell = emptyCells[i];
+		cellCandidates[cell] = candidates(cell);
+		int count = BitHelper::popCount(cellCandidates[cell]);
+		if (count < bestCount) {
+			bestCell = cell;
+			bestCount = count;
+		}
+	}
+
+	if (bestCount == 0)
+		return true;
+
+	//Each branch places one number in one cell
+	uint8_t branchCells[size];
+	uint8_t branchNumbers[size];
+	int branchCount = 0;
+
+	//If no cell is forced, a number that fits in fewer cells of a row, column or outer square than the best cell has candidates
+	//gives fewer branches, exactly like the row/column/box constraints of algorithm X
+	uint16_t unitNumber = 0;
+	int unit = bestCount > 1 ? findConstrainedUnit(cellCandidates, bestCount, unitNumber) : noUnit;
+
+	//A number that fits nowhere in one of them means this branch is dead
+	if (unit == deadEnd)
+		return true;
+
+	if (unit != noUnit) {
+		//Try the number in every cell of the unit it fits in
+		for (int i = 0; i < size; i++) {
+			uint8_t cell = units[unit][i];
+			if (cellCandidates[cell] & unitNumber) {
+				branchCells[branchCount] = cell;
+				branchNumbers[branchCount] = BitHelper::countTrailingZeros(unitNumber) + 1;
+				branchCount++;
+			}
+		}
+	}
+	else {
+		//Try every candidate of the cell from the lowest number up
+		uint16_t bestCandidates = cellCandidates[bestCell];
+		while (bestCandidates != 0) {
+			branchCells[branchCount] = bestCell;
+			branchNumbers[branchCount] = BitHelper::countTrailingZeros(bestCandidates) + 1;
+			branchCount++;
+			bestCandidates &= bestCandidates - 1;
+		}
+	}
+
+	bool keepSearching = true;
+
+	for (int branch = 0; branch < branchCount && keepSearching; branch++) {
+		uint8_t cell = branchCells[branch];
+		int num = branchNumbers[branch];
+
+		//Move the cell past the end of the remaining cells so the next level doesn't look at it
+		int index = 0;
+		while (emptyCells[index] != cell)
+			index++;
+		emptyCells[index] = emptyCells[remaining - 1];
+		emptyCells[remaining - 1] = cell;
+
+		place(cell, num);
+
+		//Update graphical component if we are solving
+		if (showProgress && progressListener)
+			progressListener(toBoard(), result.solutionCount);
+
+		keepSearching = fill(remaining - 1);
+
+		unplace(cell, num);
+
+		//Put the cell back where it was so the levels above see the same order
+		emptyCells[remaining - 1] = emptyCells[index];
+		emptyCells[index] = cell;
+	}
+
+	return keepSearching;
+}
+
+int BitboardSolver::findConstrainedUnit(const uint16_t* cellCandidates, int bestCount, uint16_t& number) const
+{
+	int bestUnit = noUnit;
+
+	for (int unit = 0; unit < size * 3; unit++) {
+		const uint8_t* cells = units[unit];
+
+		//Collect the numbers that fit in at least one, two and three cells
+		uint16_t once = 0;
+		uint16_t twice = 0;
+		uint16_t thrice = 0;
+		for (int i = 0; i < size; i++) {
+			uint16_t cellCandidate = cellCandidates[cells[i]];
+			thrice |= twice & cellCandidate;
+			twice |= once & cellCandidate;
+			once |= cellCandidate;
+		}
+
+		//Every number has to either be placed in the unit already or still fit somewhere in it
+		if ((once | unitUsed(unit)) != allNumbers)
+			return deadEnd;
+
+		//A number that fits in exactly one cell can't be beaten
+		uint16_t single = once & ~twice;
+		if (single != 0) {
+			number = single & (~single + 1);
+			return unit;
+		}
+
+		//Otherwise a number that fits in exactly two cells beats a cell with three or more candidates
+		uint16_t pair = twice & ~thrice;
+		if (pair != 0 && bestCount > 2 && bestUnit == noUnit) {
+			number = pair & (~pair + 1);
+			bestUnit = unit;
+		}
+	}
+
+	return bestUnit;
+}
+
+uint16_t BitboardSolver::candidates(int cell) const
+{
+	return ~(rowUsed[cellRow[cell]] | colUsed[cellCol[cell]] | boxUsed[cellBox[cell]]) & allNumbers;
+}
+
+uint16_t BitboardSolver::unitUsed(int unit) const
+{
+	if (unit < size)
+		return rowUsed[unit];
+	if (unit < size * 2)
+		return colUsed[unit - size];
+	return boxUsed[unit - size * 2];
+}
+
+void BitboardSolver::place(int cell, int num)
+{
+	uint16_t bit = 1 << (num - 1);
+	rowUsed[cellRow[cell]] |= bit;
+	colUsed[cellCol[cell]] |= bit;
+	boxUsed[cellBox[cell]] |= bit;
+	board[cell] = num;
+}
+
+void BitboardSolver::unplace(int cell, int num)
+{
+	uint16_t bit = ~(1 << (num - 1));
+	rowUsed[cellRow[cell]] &= bit;
+	colUsed[cellCol[cell]] &= bit;
+	boxUsed[cellBox[cell]] &= bit;
+	board[cell] = 0;
+}
+
+vector<vector<int>> BitboardSolver::toBoard() const
+{
+	vector<vector<int>> copy(size, vector<int>(size));
+	for (int cell = 0; cell < cellCount; cell++) {
+		copy[cell / size][cell % size] = board[cell];
+	}
+	return copy;
+}
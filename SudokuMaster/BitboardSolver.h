@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+#include "SolverEngine.h"
+#include "SudokuConstraints.h"
+
+using namespace std;
+
+//Solves 9x9 sudokus by plain backtracking over bitmasks instead of an exact cover matrix.
+//Every row, column and outer square keeps a 9-bit mask of the numbers it already holds, so the candidates of a cell
+//are whatever none of its three masks hold. The search always branches on the empty cell with the fewest candidates.
+//Nothing is allocated while searching.
+class BitboardSolver : public SolverEngine
+{
+public:
+	BitboardSolver();
+
+	SearchResult solve(const vector<vector<int>>& puzzle, SolutionStore& solutions, long long maxSolutions = 0, bool showProgress = false) override;
+
+	SearchResult countSolutions(const vector<vector<int>>& puzzle, long long maxSolutions = 0) override;
+
+private:
+	static constexpr int size = SudokuConstraints::size;
+	static constexpr int cellCount = SudokuConstraints::cellCount;
+	static constexpr uint16_t allNumbers = (1 << size) - 1;
+
+	//Bit n - 1 is set if the number n has been placed in the row/column/outer square
+	uint16_t rowUsed[size];
+	uint16_t colUsed[size];
+	uint16_t boxUsed[size];
+
+	//The number in each cell, 0 if empty
+	uint8_t board[cellCount];
+
+	//The cells of every row, column and outer square, in that order
+	uint8_t units[size * 3][size];
+
+	//The row, column and outer square of every cell
+	uint8_t cellRow[cellCount];
+	uint8_t cellCol[cellCount];
+	uint8_t cellBox[cellCount];
+
+	//The cells left to fill. The search only ever looks at the first remaining ones.
+	uint8_t emptyCells[cellCount];
+
+	//State of the current search
+	SolutionStore* solutions;
+	long long maxSolutions;
+	bool showProgress;
+	SearchResult result;
+
+	//Loads the puzzle into the masks. Returns false if two givens clash.
+	bool load(const vector<vector<int>>& puzzle);
+
+	SearchResult search(const vector<vector<int>>& puzzle, SolutionStore* solutions, long long maxSolutions, bool showProgress);
+
+	//Fills the first remaining empty cells. Returns false once the search should stop.
+	bool fill(int remaining);
+
+	//Looks for a row, column or outer square (numbered like units) where a number fits in fewer cells than bestCount.
+	//Returns the unit and sets number to the number's bit, deadEnd if some number fits nowhere in a unit, or noUnit.
+	int findConstrainedUnit(const uint16_t* cellCandidates, int bestCount, uint16_t& number) const;
+
+	static constexpr int noUnit = -1;
+	static constexpr int deadEnd = -2;
+
+	//Returns the numbers that can still go in the cell as a mask
+	uint16_t candidates(int cell) const;
+
+	//Returns the mask of numbers already placed in a unit
+	uint16_t unitUsed(int unit) const;
+
+	void place(int cell, int num);
+	void unplace(int cell, int num);
+
+	//Copies the board into a vector the rest of the program can read
+	vector<vector<int>> toBoard() const;
+};
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+//Compile time description of a sudoku whose outer squares are BoxRows x BoxCols cells, e.g. Board<3, 3> is the usual 9x9,
+//Board<2, 2> is 4x4, Board<2, 3> is 6x6 and Board<4, 4> is 16x16. The whole board is size x size with size = BoxRows * BoxCols.
+//Every placement of a number in a cell is one row of the exact cover matrix, numbered row * size^2 + col * size + num - 1.
+//In the classic puzzle each placement satisfies exactly four constraints (Cell, Row, Column and Box), which are the columns of the matrix:
+//   Cell:   row * size + col
+//   Row:    size^2     + row * size + num - 1
+//   Column: size^2 * 2 + col * size + num - 1
+//   Box:    size^2 * 3 + box * size + num - 1
+//The columns themselves are built by ConstraintModel, which can add more units for the variants.
+template <int BoxRows, int BoxCols>
+class Board
+{
+public:
+	static constexpr int boxRows = BoxRows;
+	static constexpr int boxCols = BoxCols;
+	static constexpr int size = boxRows * boxCols;
+	static constexpr int cellCount = size * size;
+	static constexpr int placementCount = cellCount * size;
+	static constexpr int constraintCount = cellCount * 4;
+
+	//A mask with one bit per number, bit n - 1 for the number n
+	using Mask = std::conditional_t<(size <= 16), uint16_t, uint32_t>;
+	static constexpr Mask allNumbers = (Mask)((1u << size) - 1);
+
+	//Returns the number of the outer square a cell is in. The outer squares are numbered across, then down.
+	static constexpr int boxOf(int row, int col) { return (row / boxRows) * boxRows + col / boxCols; }
+
+	//Returns the exact cover row of placing num (1 based) at row/col
+	static constexpr int placementOf(int row, int col, int num) { return row * cellCount + col * size + num - 1; }
+
+	struct Tables
+	{
+		//The cells (row * size + col) that make up each outer square
+		int boxCells[size][size];
+
+		constexpr Tables() : boxCells()
+		{
+			for (int row = 0; row < size; row++) {
+				for (int col = 0; col < size; col++) {
+					int box = boxOf(row, col);
+					boxCells[box][(row % boxRows) * boxCols + col % boxCols] = row * size + col;
+				}
+			}
+		}
+	};
+
+	static const Tables tables;
+};
+
+//Defined outside of the class so the table constructor is complete when it is evaluated at compile time
+template <int BoxRows, int BoxCols>
+inline constexpr typename Board<BoxRows, BoxCols>::Tables Board<BoxRows, BoxCols>::tables{};
@@ -0,0 +1,138 @@
+#include "CandidateGrid.h"
+#include "ExactCover/BitHelper.h"
+
+//Pick the widest instruction set the compiler is allowed to use, MSVC only defines __AVX2__ with /arch:AVX2
+//and always has SSE2 on x64
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CANDIDATE_GRID_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CANDIDATE_GRID_SSE2
+#endif
+
+CandidateGrid::CandidateGrid()
+{
+	clearAll();
+}
+
+void CandidateGrid::fillAll()
+{
+	//Nothing from before is worth going back to
+	trail.clear();
+
+	for (int i = 0; i < laneCount; i++) {
+		masks[i] = i < cellCount ? allNumbers : 0;
+	}
+}
+
+void CandidateGrid::clearAll()
+{
+	trail.clear();
+
+	for (int i = 0; i < laneCount; i++) {
+		masks[i] = 0;
+	}
+}
+
+vector<int> CandidateGrid::toList(int x, int y) const
+{
+	vector<int> list;
+	for (uint16_t mask = masks[y * size + x]; mask != 0; mask &= mask - 1) {
+		list.push_back(BitHelper::countTrailingZeros(mask) + 1);
+	}
+	return list;
+}
+
+void CandidateGrid::eliminateFromPeers(int x, int y, int num)
+{
+	const uint16_t* peers = peerTable.peers[y * size + x].lanes;
+	uint16_t bit = 1 << (num - 1);
+
+	//Every lane clears bit where the peer mask is set: mask &= ~(peer & bit)
+#if defined(CANDIDATE_GRID_AVX2)
+	__m256i bits = _mm256_set1_epi16((short)bit);
+	for (int i = 0; i < laneCount; i += 16) {
+		__m256i mask = _mm256_load_si256((const __m256i*)(masks + i));
+		__m256i peer = _mm256_load_si256((const __m256i*)(peers + i));
+		_mm256_store_si256((__m256i*)(masks + i), _mm256_andnot_si256(_mm256_and_si256(peer, bits), mask));
+	}
+#elif defined(CANDIDATE_GRID_SSE2)
+	__m128i bits = _mm_set1_epi16((short)bit);
+	for (int i = 0; i < laneCount; i += 8) {
+		__m128i mask = _mm_load_si128((const __m128i*)(masks + i));
+		__m128i peer = _mm_load_si128((const __m128i*)(peers + i));
+		_mm_store_si128((__m128i*)(masks + i), _mm_andnot_si128(_mm_and_si128(peer, bits), mask));
+	}
+#else
+	for (int i = 0; i < cellCount; i++) {
+		masks[i] &= ~(peers[i] & bit);
+	}
+#endif
+}
+
+void CandidateGrid::clearLogged(int x, int y)
+{
+	int cell = y * size + x;
+	if (masks[cell] == 0)
+		return;
+
+	trail.push_back({ (uint8_t)cell, masks[cell] });
+	masks[cell] = 0;
+}
+
+void CandidateGrid::eliminateFromPeersLogged(int x, int y, int num)
+{
+	uint16_t bit = 1 << (num - 1);
+	int cell = y * size + x;
+	//Only log the cells that still had num
+	if (masks[cell] & bit) {
+		trail.push_back({ (uint8_t)cell, masks[cell] });
+		masks[cell] &= ~bit;
+	}
+	for (uint8_t peer : peerTable.lists[cell]) {
+		if (masks[peer] & bit) {
+			trail.push_back({ peer, masks[peer] });
+			masks[peer] &= ~bit;
+		}
+	}
+}
+
+void CandidateGrid::undo(size_t mark)
+{
+	//Newest first, so a cell changed more than once ends up with its oldest mask
+	while (trail.size() > mark) {
+		masks[trail.back().cell] = trail.back().mask;
+		trail.pop_back();
+	}
+}
+
+bool CandidateGrid::hasMultipleCandidates() const
+{
+	//A mask has more than one bit set exactly when mask & (mask - 1) isn't zero
+#if defined(CANDIDATE_GRID_AVX2)
+	__m256i zero = _mm256_setzero_si256();
+	__m256i one = _mm256_set1_epi16(1);
+	__m256i found = zero;
+	for (int i = 0; i < laneCount; i += 16) {
+		__m256i mask = _mm256_load_si256((const __m256i*)(masks + i));
+		found = _mm256_or_si256(found, _mm256_and_si256(mask, _mm256_sub_epi16(mask, one)));
+	}
+	return !_mm256_testz_si256(found, found);
+#elif defined(CANDIDATE_GRID_SSE2)
+	__m128i zero = _mm_setzero_si128();
+	__m128i one = _mm_set1_epi16(1);
+	__m128i found = zero;
+	for (int i = 0; i < laneCount; i += 8) {
+		__m128i mask = _mm_load_si128((const __m128i*)(masks + i));
+		found = _mm_or_si128(found, _mm_and_si128(mask, _mm_sub_epi16(mask, one)));
+	}
+	return _mm_movemask_epi8(_mm_cmpeq_epi16(found, zero)) != 0xFFFF;
+#else
+	for (int i = 0; i < cellCount; i++) {
+		if (masks[i] & (masks[i] - 1))
+			return true;
+	}
+	return false;
+#endif
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "SudokuConstraints.h"
+
+using namespace std;
+
+//The numbers that can still go in every cell of a 9x9 sudoku, kept as one 9-bit mask per cell (bit n - 1 for the number n).
+//The 81 masks sit next to each other in memory so that the operations on the whole grid can work on 16 (AVX2) or 8 (SSE2)
+//cells at a time. Without either instruction set the same operations are done one cell at a time.
+class CandidateGrid
+{
+public:
+	static constexpr int size = SudokuConstraints::size;
+	static constexpr int cellCount = SudokuConstraints::cellCount;
+	static constexpr uint16_t allNumbers = (1 << size) - 1;
+
+	//The masks are padded up to a whole number of AVX2 registers, the padding cells never hold candidates
+	static constexpr int laneCount = 96;
+
+	//A set of cells, every cell in the set has all 16 bits of its lane set so it can be used as a mask directly
+	struct CellSet
+	{
+		alignas(32) uint16_t lanes[laneCount] = {};
+	};
+
+	CandidateGrid();
+
+	//Gives every cell every number as a candidate
+	void fillAll();
+
+	//Takes every candidate away from every cell
+	void clearAll();
+
+	//Returns the candidates of the cell as a mask
+	uint16_t get(int x, int y) const { return masks[y * size + x]; }
+
+	bool has(int x, int y, int num) const { return (masks[y * size + x] & (1 << (num - 1))) != 0; }
+
+	void add(int x, int y, int num) { masks[y * size + x] |= 1 << (num - 1); }
+
+	void remove(int x, int y, int num) { masks[y * size + x] &= ~(1 << (num - 1)); }
+
+	void clear(int x, int y) { masks[y * size + x] = 0; }
+
+	//Lists the candidates of the cell from smallest to largest
+	vector<int> toList(int x, int y) const;
+
+	//Takes num away from the candidates of every cell in the row, column and outer square of the cell, including the cell itself
+	void eliminateFromPeers(int x, int y, int num);
+
+	//Returns true if any cell has more than one candidate
+	bool hasMultipleCandidates() const;
+
+	//A mask changed by one of the logged operations below, and what it was before the change
+	struct TrailEntry
+	{
+		uint8_t cell;
+		uint16_t mask;
+	};
+
+	//The logged operations do the same as the ones above, but only touch the cells they actually change and write down
+	//what those cells were first. undo() then puts back exactly what changed since a mark, so a trial placement costs
+	//as much as the candidates it takes away instead of a copy of the whole grid.
+	size_t trailMark() const { return trail.size(); }
+
+	void clearLogged(int x, int y);
+
+	void eliminateFromPeersLogged(int x, int y, int num);
+
+	//Puts every mask changed since the mark back the way it was
+	void undo(size_t mark);
+
+	//Every change logged so far, the oldest first. The changes since a mark start at index mark.
+	const vector<TrailEntry>& getTrail() const { return trail; }
+
+	//The number of other cells in the row, column and outer square of a cell
+	static constexpr int peerCount = 2 * (size - 1) + (SudokuConstraints::boxRows - 1) * (SudokuConstraints::boxCols - 1);
+	static_assert(size != 9 || peerCount == 20, "Every cell of a 9x9 sudoku has 20 peers");
+
+	//The row, column and outer square of every cell. The sets include the cell itself for the whole grid operations,
+	//the lists for the logged ones only have the other cells.
+	struct PeerTable
+	{
+		CellSet peers[cellCount];
+		uint8_t lists[cellCount][peerCount];
+
+		constexpr PeerTable() : peers(), lists()
+		{
+			for (int cell = 0; cell < cellCount; cell++) {
+				int row = cell / size;
+				int col = cell % size;
+				int listed = 0;
+				for (int other = 0; other < cellCount; other++) {
+					int otherRow = other / size;
+					int otherCol = other % size;
+					if (otherRow == row || otherCol == col || SudokuConstraints::boxOf(otherRow, otherCol) == SudokuConstraints::boxOf(row, col)) {
+						peers[cell].lanes[other] = 0xFFFF;
+						if (other != cell)
+							lists[cell][listed++] = (uint8_t)other;
+					}
+				}
+			}
+		}
+	};
+
+	static const PeerTable peerTable;
+
+private:
+	alignas(32) uint16_t masks[laneCount];
+
+	vector<TrailEntry> trail;
+};
+
+//Defined outside of the class so the table constructor is complete when it is evaluated at compile time
+inline constexpr CandidateGrid::PeerTable CandidateGrid::peerTable{};
@@ -0,0 +1,146 @@
+#include "ConstraintModel.h"
+#include <stdexcept>
+
+template <class Geometry>
+BasicConstraintModel<Geometry>::BasicConstraintModel(bool boxes)
+{
+	for (int row = 0; row < size; row++) {
+		vector<int> cells(size);
+		for (int col = 0; col < size; col++) {
+			cells[col] = row * size + col;
+		}
+		units.push_back(cells);
+	}
+
+	for (int col = 0; col < size; col++) {
+		vector<int> cells(size);
+		for (int row = 0; row < size; row++) {
+			cells[row] = row * size + col;
+		}
+		units.push_back(cells);
+	}
+
+	if (boxes) {
+		for (int box = 0; box < size; box++) {
+			units.emplace_back(Geometry::tables.boxCells[box], Geometry::tables.boxCells[box] + size);
+		}
+	}
+}
+
+template <class Geometry>
+BasicConstraintModel<Geometry> BasicConstraintModel<Geometry>::jigsaw(const vector<vector<int>>& regions)
+{
+	BasicConstraintModel model(false);
+
+	vector<vector<int>> regionCells(size);
+	for (int row = 0; row < size; row++) {
+		for (int col = 0; col < size; col++) {
+			int region = regions[row][col];
+			if (region < 0 || region >= size)
+				throw invalid_argument("Region numbers have to be between 0 and the size of the board");
+			regionCells[region].push_back(row * size + col);
+		}
+	}
+
+	for (const vector<int>& cells : regionCells) {
+		model.addUnit(cells);
+	}
+
+	return model;
+}
+
+template <class Geometry>
+void BasicConstraintModel<Geometry>::addUnit(const vector<int>& cells)
+{
+	if (cells.size() != size)
+		throw invalid_argument("A unit has to have one cell per number");
+
+	vector<bool> seen(cellCount, false);
+	for (int cell : cells) {
+		if (cell < 0 || cell >= cellCount || seen[cell])
+			throw invalid_argument("A unit has to be made of different cells on the board");
+		seen[cell] = true;
+	}
+
+	units.push_back(cells);
+}
+
+template <class Geometry>
+void BasicConstraintModel<Geometry>::addDiagonals()
+{
+	vector<int> down(size);
+	vector<int> up(size);
+	for (int i = 0; i < size; i++) {
+		down[i] = i * size + i;
+		up[i] = (size - 1 - i) * size + i;
+	}
+	addUnit(down);
+	addUnit(up);
+}
+
+template <class Geometry>
+void BasicConstraintModel<Geometry>::addWindows()
+{
+	//On a 9x9 board the windows start on rows and columns 1 and 5
+	for (int top = 1; top + Geometry::boxRows < size; top += Geometry::boxRows + 1) {
+		for (int left = 1; left + Geometry::boxCols < size; left += Geometry::boxCols + 1) {
+			vector<int> cells;
+			for (int row = top; row < top + Geometry::boxRows; row++) {
+				for (int col = left; col < left + Geometry::boxCols; col++) {
+					cells.push_back(row * size + col);
+				}
+			}
+			addUnit(cells);
+		}
+	}
+}
+
+template <class Geometry>
+const vector<vector<int>>& BasicConstraintModel<Geometry>::getUnits() const
+{
+	return units;
+}
+
+template <class Geometry>
+int BasicConstraintModel<Geometry>::getConstraintCount() const
+{
+	return cellCount + units.size() * size;
+}
+
+template <class Geometry>
+vector<vector<int>> BasicConstraintModel<Geometry>::placementRows() const
+{
+	vector<vector<int>> unitsOfCell = cellUnits();
+
+	vector<vector<int>> rows(Geometry::placementCount);
+	for (int cell = 0; cell < cellCount; cell++) {
+		for (int num = 1; num <= size; num++) {
+			vector<int>& columns = rows[Geometry::placementOf(cell / size, cell % size, num)];
+			columns.reserve(unitsOfCell[cell].size() + 1);
+			columns.push_back(cell);
+			for (int unit : unitsOfCell[cell]) {
+				columns.push_back(cellCount + unit * size + num - 1);
+			}
+		}
+	}
+	return rows;
+}
+
+template <class Geometry>
+vector<vector<int>> BasicConstraintModel<Geometry>::cellUnits() const
+{
+	vector<vector<int>> unitsOfCell(cellCount);
+	for (size_t unit = 0; unit < units.size(); unit++) {
+		for (int cell : units[unit]) {
+			unitsOfCell[cell].push_back((int)unit);
+		}
+	}
+	return unitsOfCell;
+}
+
+//The board sizes the model is built for
+template class BasicConstraintModel<Board<2, 2>>;
+template class BasicConstraintModel<Board<2, 3>>;
+template class BasicConstraintModel<Board<3, 3>>;
+template class BasicConstraintModel<Board<4, 4>>;
+template class BasicConstraintModel<Board<5, 5>>;
@@ -0,0 +1,54 @@
+#pragma once
+#include <vector>
+#include "SudokuConstraints.h"
+
+using namespace std;
+
+//Describes which groups of cells (units) of a sudoku have to hold every number exactly once, so variants can be solved
+//by the same exact cover search as the classic puzzle. Every cell is one constraint, and every unit adds one constraint per number:
+//   Cell: row * size + col
+//   Unit: size^2 + unit * size + num - 1
+//A placement covers its cell and the number's column of each unit the cell is in. The classic model lists the rows, then the
+//columns, then the outer squares, which gives exactly the columns described in Board.h.
+//Variants only add units (or swap out the outer squares), e.g. the diagonals of X-sudoku, the irregular regions of jigsaw
+//or the extra windows of windoku.
+template <class Geometry>
+class BasicConstraintModel
+{
+public:
+	static constexpr int size = Geometry::size;
+	static constexpr int cellCount = Geometry::cellCount;
+
+	//Starts out with the rows and columns, and the outer squares as well unless boxes is false
+	BasicConstraintModel(bool boxes = true);
+
+	//The rows and columns plus irregular regions instead of the outer squares. regions[row][col] is the region (0 to size - 1) of the cell.
+	//Throws invalid_argument if a region doesn't have exactly size cells.
+	static BasicConstraintModel jigsaw(const vector<vector<int>>& regions);
+
+	//Adds a unit of size cells (row * size + col) that must hold every number exactly once.
+	//Throws invalid_argument if it isn't size different cells on the board.
+	void addUnit(const vector<int>& cells);
+
+	//Adds both long diagonals (X-sudoku)
+	void addDiagonals();
+
+	//Adds the windows of windoku, the squares the size of an outer square with one row/column between them and the edges
+	void addWindows();
+
+	const vector<vector<int>>& getUnits() const;
+
+	//The number of columns of the exact cover matrix
+	int getConstraintCount() const;
+
+	//The columns covered by every placement, in the row order of Geometry::placementOf
+	vector<vector<int>> placementRows() const;
+
+	//The units each cell is in, in the order they were added
+	vector<vector<int>> cellUnits() const;
+
+private:
+	vector<vector<int>> units;
+};
+
+using ConstraintModel = BasicConstraintModel<SudokuConstraints>;
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+//Small portable wrappers around the bit scanning instructions of the compiler
+class BitHelper
+{
+public:
+	//Returns the index of the lowest set bit. The value must not be zero.
+	static inline int countTrailingZeros(uint64_t value)
+	{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+		unsigned long index;
+		_BitScanForward64(&index, value);
+		return (int)index;
+#elif defined(_MSC_VER)
+		//32-bit builds only have the 32-bit scan, so check each half
+		unsigned long index;
+		if (_BitScanForward(&index, (unsigned long)value))
+			return (int)index;
+		_BitScanForward(&index, (unsigned long)(value >> 32));
+		return (int)index + 32;
+#else
+		return __builtin_ctzll(value);
+#endif
+	}
+
+	//Returns the number of set bits
+	static inline int popCount(uint32_t value)
+	{
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+		return (int)__popcnt(value);
+#elif defined(_MSC_VER)
+		//Count the bits in parallel within each byte and then add the bytes up
+		value = value - ((value >> 1) & 0x55555555);
+		value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+		return (int)((((value + (value >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+#else
+		return __builtin_popcount(value);
+#endif
+	}
+};
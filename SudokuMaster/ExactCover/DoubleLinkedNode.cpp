@@ -0,0 +1,20 @@
+#include "DoubleLinkedNode.h"
+
+
+DoubleLinkedNode::DoubleLinkedNode()
+{
+    right = 0;
+    left = 0;
+    down = 0;
+    up = 0;
+    columnHeader = 0;
+    rowID = 0;
+    colID = 0;
+    nodeCount = 0;
+}
+
+void DoubleLinkedNode::setRowCol(int col, int row)
+{
+    rowID = row;
+    colID = col;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include<cstdint>
+#include<vector>
+
+using namespace std;
+
+//A single node of a DoubleLinkedNodeMatrix.
+//Nodes live in one contiguous pool owned by the matrix, so every link is the 32-bit index of the neighbor in that pool
+//instead of a pointer. Walking the matrix never has to touch a reference count.
+class DoubleLinkedNode
+{
+public:
+	DoubleLinkedNode();
+
+	uint32_t right;
+	uint32_t left;
+	uint32_t down;
+	uint32_t up;
+
+	uint32_t columnHeader;
+
+	int getRow() const { return rowID; }
+	void setRow(int row) { rowID = row; }
+	int getCol() const { return colID; }
+	void setCol(int col) { colID = col; }
+	void setRowCol(int col, int row);
+
+	int getNodeCount() const { return nodeCount; }
+	void incrementNodeCount() { nodeCount++; }
+	void decrementNodeCount() { nodeCount--; }
+
+private:
+	int rowID;
+	int colID;
+	int nodeCount;
+
+
+};
@@ -0,0 +1,230 @@
+#include "DoubleLinkedNodeMatrix.h"
+#include "BitHelper.h"
+#include <algorithm>
+
+DoubleLinkedNodeMatrix::DoubleLinkedNodeMatrix(int nCols, const vector<vector<int>>& rows, int nPrimaryCols)
+{
+	this->nCols = nCols;
+	this->nPrimaryCols = (nPrimaryCols < 0 || nPrimaryCols > nCols) ? nCols : nPrimaryCols;
+
+	//Count the ones so the pool is allocated exactly once
+	size_t nNodes = nCols + 2;
+	for (const vector<int>& row : rows) {
+		nNodes += row.size();
+	}
+	nodes.reserve(nNodes);
+	rowStarts.assign(rows.size() + 1, noRow);
+
+	//Create the column headers, each one starts out linked to itself vertically
+	nodes.resize(nCols + 2);
+	for (int col = 0; col < nCols; col++) {
+		nodes[col].setRowCol(col, 0);
+		nodes[col].columnHeader = col;
+		nodes[col].up = col;
+		nodes[col].down = col;
+		nodes[col].left = col - 1;
+		nodes[col].right = col + 1;
+	}
+
+	//The root header closes the ring of primary column headers, and the secondary header the ring of the rest
+	header = nCols;
+	secondaryHeader = nCols + 1;
+	linkRing(header, 0, this->nPrimaryCols);
+	linkRing(secondaryHeader, this->nPrimaryCols, nCols);
+
+	for (size_t row = 0; row < rows.size(); row++) {
+		//Empty rows can never be part of a solution, so they are simply skipped
+		if (rows[row].empty())
+			continue;
+
+		uint32_t first = nodes.size();
+		rowStarts[row + 1] = first;
+
+		for (int col : rows[row]) {
+			uint32_t index = nodes.size();
+			nodes.emplace_back();
+			DoubleLinkedNode& node = nodes.back();
+
+			//Row 0 is the column header row, so the first sparse row has an ID of 1
+			node.setRowCol(col, row + 1);
+			node.columnHeader = col;
+
+			//Append the node to the bottom of its column
+			node.up = nodes[col].up;
+			node.down = col;
+			nodes[nodes[col].up].down = index;
+			nodes[col].up = index;
+			nodes[col].incrementNodeCount();
+
+			//Link the node after the previous node of the row, closing the ring back to the first node of the row
+			node.left = (index == first) ? index : index - 1;
+			node.right = first;
+			nodes[node.left].right = index;
+			nodes[first].left = index;
+		}
+	}
+
+	//Sort every column into the bucket of its count.
+	//The secondary columns get buckets too, which keeps the count updates free of checks, but minColumn never looks at them.
+	maxCount = 0;
+	for (int col = 0; col < nCols; col++) {
+		maxCount = max(maxCount, nodes[col].getNodeCount());
+	}
+	bucketWords = (nCols + 63) / 64;
+	primaryWords = (this->nPrimaryCols + 63) / 64;
+	lastPrimaryMask = (this->nPrimaryCols % 64 == 0) ? ~uint64_t(0) : (uint64_t(1) << (this->nPrimaryCols % 64)) - 1;
+	countBuckets.assign((maxCount + 1) * bucketWords, 0);
+	for (int col = 0; col < nCols; col++) {
+		bucketInsert(col, nodes[col].getNodeCount());
+	}
+
+}
+
+bool DoubleLinkedNodeMatrix::empty()
+{
+	return nodes[header].right == header;
+}
+
+uint32_t DoubleLinkedNodeMatrix::minColumn()
+{
+	//Check the buckets from the lowest count up, a column with 0 or 1 ones is found straight away
+	for (int count = 0; count <= maxCount; count++) {
+		const uint64_t* bucket = &countBuckets[count * bucketWords];
+		for (int word = 0; word < primaryWords; word++) {
+			uint64_t columns = (word == primaryWords - 1) ? bucket[word] & lastPrimaryMask : bucket[word];
+			if (columns != 0) {
+				//Column headers are the first nodes of the pool, so the column number is also its header's index
+				return word * 64 + BitHelper::countTrailingZeros(columns);
+			}
+		}
+	}
+
+	return header;
+}
+
+void DoubleLinkedNodeMatrix::cover(uint32_t node)
+{
+	uint32_t colNode = nodes[node].columnHeader;
+
+	//Unlink column header from its neighbors
+	nodes[nodes[colNode].left].right = nodes[colNode].right;
+	nodes[nodes[colNode].right].left = nodes[colNode].left;
+	bucketRemove(colNode, nodes[colNode].getNodeCount());
+
+	for (uint32_t row = nodes[colNode].down; row != colNode; row = nodes[row].down) {
+		for (uint32_t rightNode = nodes[row].right; rightNode != row; rightNode = nodes[rightNode].right) {
+			DoubleLinkedNode& n = nodes[rightNode];
+
+			//unlink row node from its north and south neighbors
+			nodes[n.up].down = n.down;
+			nodes[n.down].up = n.up;
+
+			//Decrement the column count for the column of the node we are unlinking
+			decrementCount(n.columnHeader);
+
+		}
+	}
+
+}
+
+void DoubleLinkedNodeMatrix::uncover(uint32_t node)
+{
+	uint32_t colNode = nodes[node].columnHeader;
+
+	//Relink nodes in reverse order
+	for (uint32_t row = nodes[colNode].up; row != colNode; row = nodes[row].up) {
+		for (uint32_t leftNode = nodes[row].left; leftNode != row; leftNode = nodes[leftNode].left) {
+			DoubleLinkedNode& n = nodes[leftNode];
+
+			//link row node back to its north and south neighbors
+			nodes[n.up].down = leftNode;
+			nodes[n.down].up = leftNode;
+
+			//increment the column count for the column of the node we are relinking
+			incrementCount(n.columnHeader);
+
+		}
+	}
+
+	//link column header to its neighbors
+	nodes[nodes[colNode].left].right = colNode;
+	nodes[nodes[colNode].right].left = colNode;
+	bucketInsert(colNode, nodes[colNode].getNodeCount());
+
+}
+
+bool DoubleLinkedNodeMatrix::selectRow(int rowID)
+{
+	if (rowID <= 0 || (size_t)rowID >= rowStarts.size() || rowStarts[rowID] == noRow)
+		return false;
+
+	uint32_t first = rowStarts[rowID];
+
+	//Make sure no earlier selection already satisfied one of the columns of this row
+	uint32_t node = first;
+	do {
+		if (!columnActive(nodes[node].columnHeader))
+			return false;
+		node = nodes[node].right;
+	} while (node != first);
+
+	//Cover the columns in the same order the search does when it picks a row
+	cover(first);
+	for (uint32_t rightNode = nodes[first].right; rightNode != first; rightNode = nodes[rightNode].right)
+		cover(rightNode);
+
+	return true;
+}
+
+void DoubleLinkedNodeMatrix::deselectRow(int rowID)
+{
+	uint32_t first = rowStarts[rowID];
+
+	//Uncover in the exact reverse order of selectRow
+	for (uint32_t leftNode = nodes[first].left; leftNode != first; leftNode = nodes[leftNode].left)
+		uncover(leftNode);
+	uncover(first);
+}
+
+void DoubleLinkedNodeMatrix::bucketInsert(uint32_t column, int count)
+{
+	countBuckets[count * bucketWords + column / 64] |= uint64_t(1) << (column % 64);
+}
+
+void DoubleLinkedNodeMatrix::bucketRemove(uint32_t column, int count)
+{
+	countBuckets[count * bucketWords + column / 64] &= ~(uint64_t(1) << (column % 64));
+}
+
+void DoubleLinkedNodeMatrix::decrementCount(uint32_t column)
+{
+	bucketRemove(column, nodes[column].getNodeCount());
+	nodes[column].decrementNodeCount();
+	bucketInsert(column, nodes[column].getNodeCount());
+}
+
+void DoubleLinkedNodeMatrix::incrementCount(uint32_t column)
+{
+	bucketRemove(column, nodes[column].getNodeCount());
+	nodes[column].incrementNodeCount();
+	bucketInsert(column, nodes[column].getNodeCount());
+}
+
+void DoubleLinkedNodeMatrix::linkRing(uint32_t root, int firstCol, int endCol)
+{
+	//Link root <-> firstCol <-> ... <-> endCol - 1 <-> root
+	uint32_t previous = root;
+	for (int col = firstCol; col < endCol; col++) {
+		nodes[col].left = previous;
+		nodes[previous].right = col;
+		previous = col;
+	}
+	nodes[previous].right = root;
+	nodes[root].left = previous;
+}
+
+bool DoubleLinkedNodeMatrix::columnActive(uint32_t column)
+{
+	//A covered column header still points at its old neighbors, but they no longer point back at it
+	return nodes[nodes[column].left].right == column;
+}
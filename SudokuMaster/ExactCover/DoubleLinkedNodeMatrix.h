@@ -0,0 +1,86 @@
+#pragma once
+#include "DoubleLinkedNode.h"
+#include <vector>
+
+using namespace std;
+
+class DoubleLinkedNodeMatrix
+{
+public:
+	//Builds the matrix from sparse rows: rows[i] lists the columns that have a one in row i + 1
+	//(row 0 is the column header row). Only the ones are allocated and every node is linked in a single pass.
+	//The columns from nPrimaryCols on are secondary: they can be covered at most once instead of exactly once,
+	//so the search never picks them and the matrix counts as empty while they are still uncovered. By default every column is primary.
+	DoubleLinkedNodeMatrix(int nCols, const vector<vector<int>>& rows, int nPrimaryCols = -1);
+
+	//Returns if every primary column is covered
+	bool empty();
+
+	//Returns the index of the column header with the lowest number of ones
+	//Ties go to the leftmost column. Columns are kept in buckets by their count, so this never has to walk the header row.
+	uint32_t minColumn();
+
+	//Cover the column/rows of the given node
+	void cover(uint32_t node);
+
+	//Uncover the column/rows of the given node
+	void uncover(uint32_t node);
+
+	//Covers every column of the given row as if the row had been chosen as part of the solution.
+	//Returns false and leaves the matrix untouched if the row does not exist or one of its columns is already covered.
+	bool selectRow(int rowID);
+
+	//Undoes selectRow. Rows must be deselected in the reverse order they were selected in.
+	void deselectRow(int rowID);
+
+	//Access a node of the pool by its index
+	DoubleLinkedNode& operator[](uint32_t node) { return nodes[node]; }
+
+private:
+
+	//Links the column headers from firstCol up to (not including) endCol into a ring with the given root header
+	void linkRing(uint32_t root, int firstCol, int endCol);
+
+	//Returns if the column of the given header is still linked into the header row
+	bool columnActive(uint32_t column);
+
+	uint32_t header;
+
+	//The secondary columns are linked into a ring of their own, so they are left out of the search but can still be covered
+	uint32_t secondaryHeader;
+
+	int nCols;
+
+	int nPrimaryCols;
+
+	//The index of the first node of every row, by row ID. Rows without any nodes hold noRow.
+	vector<uint32_t> rowStarts;
+
+	static constexpr uint32_t noRow = UINT32_MAX;
+
+	//The uncovered columns grouped by their number of ones, one bit per column.
+	//Bucket n takes up bucketWords words starting at n * bucketWords.
+	vector<uint64_t> countBuckets;
+
+	int bucketWords;
+
+	//minColumn only looks at the words holding primary columns, and masks the secondary columns out of the last of them
+	int primaryWords;
+	uint64_t lastPrimaryMask;
+
+	//The highest number of ones any column started out with, which is the last bucket
+	int maxCount;
+
+	//Add/remove a column to/from the bucket of the given count
+	void bucketInsert(uint32_t column, int count);
+	void bucketRemove(uint32_t column, int count);
+
+	//Update the count of a column, moving it to its new bucket
+	void decrementCount(uint32_t column);
+	void incrementCount(uint32_t column);
+
+	//Every node of the matrix, stored contiguously.
+	//The column headers come first, followed by the root header and then the nodes of each row in order.
+	vector<DoubleLinkedNode> nodes;
+
+};
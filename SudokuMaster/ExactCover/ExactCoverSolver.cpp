@@ -0,0 +1,228 @@
+#include "ExactCoverSolver.h"
+
+ExactCoverSolver::ExactCoverSolver(int primaryColumns, const vector<vector<int>>& rows, int secondaryColumns) :
+	matrix(primaryColumns + secondaryColumns, rows, primaryColumns)
+{
+}
+
+ExactCoverSolver::SearchResult ExactCoverSolver::solve(const SolutionCallback& onSolution, long long maxSolutions, long long maxNodes)
+{
+	SearchResult result{ 0, 0, false };
+
+	start();
+	setNodeLimit(maxNodes);
+
+	while (next()) {
+		result.solutionCount++;
+
+		//The callback can end the search early, the same as a limit would
+		if (onSolution && !onSolution(partialSolution)) {
+			result.limitReached = true;
+			break;
+		}
+
+		if (maxSolutions > 0 && result.solutionCount >= maxSolutions) {
+			result.limitReached = true;
+			break;
+		}
+	}
+
+	result.nodes = nodeCount;
+	result.limitReached = result.limitReached || limitHit;
+
+	//Restore the matrix for the next search
+	stop();
+
+	return result;
+}
+
+ExactCoverSolver::SearchResult ExactCoverSolver::countSolutions(long long maxSolutions, long long maxNodes)
+{
+	return solve(nullptr, maxSolutions, maxNodes);
+}
+
+bool ExactCoverSolver::start(const vector<int>& givenRows)
+{
+	stop();
+	state = State::finished;
+
+	for (int row : givenRows) {
+		//Row 0 of the matrix is the column header row, so the rows we were given are one further down
+		if (!matrix.selectRow(row + 1))
+			return false;
+		this->givenRows.push_back(row);
+	}
+
+	//The fixed rows and the givens are already part of every solution
+	partialSolution = fixedRows;
+	partialSolution.insert(partialSolution.end(), this->givenRows.begin(), this->givenRows.end());
+	state = State::ready;
+	return true;
+}
+
+bool ExactCoverSolver::next()
+{
+	switch (state) {
+	case State::idle:
+	case State::finished:
+		return false;
+
+	case State::ready:
+		//If the matrix is already empty, the givens are the one and only solution
+		if (matrix.empty()) {
+			state = State::finished;
+			solutionCount++;
+			return true;
+		}
+
+		//Step 1 and 2 -- The matrix is not empty, so determine the column with the least number of 1s in it and cover it.
+		searchStack.clear();
+		pushColumn();
+		state = State::running;
+		break;
+
+	case State::running:
+		//The last call stopped at a solution, move on to the next row of the column it stopped in
+		nextRow(searchStack.back());
+		break;
+	}
+
+	while (!searchStack.empty()) {
+		SearchFrame& frame = searchStack.back();
+
+		//Step 3 -- Once every row of this column has been tried, uncover it and step back up a level to the next row there
+		if (frame.rowNode == frame.column) {
+			matrix.uncover(frame.column);
+			searchStack.pop_back();
+			if (!searchStack.empty())
+				nextRow(searchStack.back());
+			continue;
+		}
+
+		//Step 4 -- Include this row in the partial solution
+		partialSolution.push_back(matrix[frame.rowNode].getRow() - 1);
+		nodeCount++;
+
+		if (progressListener)
+			progressListener(partialSolution);
+
+		//Step 5 -- cover all rows with 1s in them that have a 1 in the column we are covering
+		for (uint32_t rightNode = matrix[frame.rowNode].right; rightNode != frame.rowNode; rightNode = matrix[rightNode].right)
+			matrix.cover(rightNode);
+
+		if (matrix.empty()) {
+			//If the matrix is empty, then this branch has terminated successfully!
+			//The partial solution is guaranteed to be a whole solution now, so stop here until the next one is asked for
+			solutionCount++;
+			return true;
+		}
+
+		//The node budget is used up. The row is left in place like at a solution, so stop can unwind it.
+		if (nodeLimit > 0 && nodeCount >= nodeLimit) {
+			limitHit = true;
+			state = State::finished;
+			return false;
+		}
+
+		//Step down a level and travel down this branch of the row, start again with the more covered up matrix
+		pushColumn();
+	}
+
+	//Every branch has been tried
+	state = State::finished;
+	return false;
+}
+
+void ExactCoverSolver::stop()
+{
+	//Every level of the search still has a row in the partial solution, so unwind them all to leave the matrix as we found it
+	while (!searchStack.empty()) {
+		SearchFrame& top = searchStack.back();
+		nextRow(top);
+		matrix.uncover(top.column);
+		searchStack.pop_back();
+	}
+	partialSolution.clear();
+
+	for (int i = givenRows.size() - 1; i >= 0; i--) {
+		matrix.deselectRow(givenRows[i] + 1);
+	}
+	givenRows.clear();
+
+	state = State::idle;
+	solutionCount = 0;
+	nodeCount = 0;
+	nodeLimit = 0;
+	limitHit = false;
+}
+
+bool ExactCoverSolver::fixRow(int row)
+{
+	//The givens of a search sit on top of the fixed rows, so they have to come off first
+	stop();
+
+	if (!matrix.selectRow(row + 1))
+		return false;
+	fixedRows.push_back(row);
+	return true;
+}
+
+void ExactCoverSolver::unfixRow()
+{
+	stop();
+
+	matrix.deselectRow(fixedRows.back() + 1);
+	fixedRows.pop_back();
+}
+
+const vector<int>& ExactCoverSolver::getFixedRows() const
+{
+	return fixedRows;
+}
+
+const vector<int>& ExactCoverSolver::getSolution() const
+{
+	return partialSolution;
+}
+
+long long ExactCoverSolver::getSolutionCount() const
+{
+	return solutionCount;
+}
+
+long long ExactCoverSolver::getNodeCount() const
+{
+	return nodeCount;
+}
+
+void ExactCoverSolver::setNodeLimit(long long maxNodes)
+{
+	nodeLimit = maxNodes;
+}
+
+bool ExactCoverSolver::nodeLimitReached() const
+{
+	return limitHit;
+}
+
+void ExactCoverSolver::pushColumn()
+{
+	uint32_t column = matrix.minColumn();
+
+	//Cover the column selected
+	matrix.cover(column);
+
+	searchStack.push_back({ column, matrix[column].down });
+}
+
+void ExactCoverSolver::nextRow(SearchFrame& frame)
+{
+	//Pop off the row since we are done with it
+	partialSolution.pop_back();
+
+	//uncover the rows covered by it
+	for (uint32_t leftNode = matrix[frame.rowNode].left; leftNode != frame.rowNode; leftNode = matrix[leftNode].left)
+		matrix.uncover(leftNode);
+
+	frame.rowNode = matrix[frame.rowNode].down;
+}
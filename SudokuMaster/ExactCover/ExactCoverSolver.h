@@ -0,0 +1,108 @@
+#pragma once
+#include <vector>
+#include <functional>
+#include "DoubleLinkedNodeMatrix.h"
+
+using namespace std;
+
+//Algorithm X over a DoubleLinkedNodeMatrix, for any exact cover problem.
+//The problem is given as rows of column numbers: the primary columns (0 to primaryColumns - 1) have to be covered exactly once,
+//the secondary columns after them at most once. Rows are numbered from 0 in the order they are given, and a solution is the list of its rows.
+//The search keeps its own stack instead of recursing, so it can stop at a solution and pick up from there later.
+class ExactCoverSolver
+{
+public:
+	struct SearchResult
+	{
+		long long solutionCount;
+		//The number of rows tried, i.e. the nodes of the search tree
+		long long nodes;
+		//True if the search stopped at a limit or because the callback asked it to, rather than running out of rows to try
+		bool limitReached;
+	};
+
+	//Called with the rows of every solution found. Returning false stops the search.
+	using SolutionCallback = function<bool(const vector<int>& rows)>;
+
+	ExactCoverSolver(int primaryColumns, const vector<vector<int>>& rows, int secondaryColumns = 0);
+
+	//Finds every solution, or stops after maxSolutions solutions or maxNodes rows tried (0 means no limit)
+	SearchResult solve(const SolutionCallback& onSolution, long long maxSolutions = 0, long long maxNodes = 0);
+
+	SearchResult countSolutions(long long maxSolutions = 0, long long maxNodes = 0);
+
+	//Starts a search one solution at a time, with the given rows already part of every solution.
+	//Returns false if the given rows overlap, in which case there are no solutions. Drops the search in progress, if any.
+	bool start(const vector<int>& givenRows = {});
+
+	//Runs the search to the next solution, which is then in getSolution. Returns false once there are no more,
+	//or if the node limit is reached first.
+	bool next();
+
+	//Drops the search in progress and restores the matrix
+	void stop();
+
+	//The rows of the last solution found, starting with the fixed and given ones. While searching, the rows chosen so far.
+	const vector<int>& getSolution() const;
+
+	//The number of solutions and rows tried since start
+	long long getSolutionCount() const;
+	long long getNodeCount() const;
+
+	//Makes next give up once this many rows have been tried since start, 0 means no limit. Stopping the search clears the limit.
+	void setNodeLimit(long long maxNodes);
+
+	bool nodeLimitReached() const;
+
+	//Fixed rows stay selected between searches, underneath the given rows of every start (and every solve).
+	//They are for asking about the same problem over and over with small changes, e.g. whether a puzzle is still unique with one clue
+	//less, without selecting everything again for each question. They form a stack, only the last one fixed can be unfixed.
+	//Returns false if the row overlaps a fixed row, in which case nothing changes. Drops the search in progress, if any.
+	bool fixRow(int row);
+
+	//Unfixes the last row fixed. Drops the search in progress, if any.
+	void unfixRow();
+
+	const vector<int>& getFixedRows() const;
+
+	//Called with the rows chosen so far every time the search adds a row, if set. Meant for showing the search as it goes.
+	function<void(const vector<int>& rows)> progressListener;
+
+private:
+	DoubleLinkedNodeMatrix matrix;
+
+	//The rows chosen so far, the fixed and given ones first
+	vector<int> partialSolution;
+
+	//The rows selected by fixRow, in the order they were fixed
+	vector<int> fixedRows;
+
+	//The rows selected by start
+	vector<int> givenRows;
+
+	//Where the search is at:
+	//idle - not started, ready - givens selected but not searched yet, running - stopped at a solution, finished - no solutions left
+	enum class State { idle, ready, running, finished };
+	State state = State::idle;
+
+	long long solutionCount = 0;
+	long long nodeCount = 0;
+	long long nodeLimit = 0;
+	bool limitHit = false;
+
+	//One level of the search: the column being satisfied and the row of that column currently being tried
+	struct SearchFrame
+	{
+		uint32_t column;
+		uint32_t rowNode;
+	};
+
+	//One frame per row in the partial solution (besides the givens)
+	vector<SearchFrame> searchStack;
+
+	//Picks the next column to satisfy, covers it and pushes a frame for it onto the search stack
+	void pushColumn();
+
+	//Removes the row being tried in the frame from the partial solution and moves the frame on to the next row of its column
+	void nextRow(SearchFrame& frame);
+};
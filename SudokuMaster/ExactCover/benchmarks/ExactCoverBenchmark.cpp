@@ -0,0 +1,165 @@
+/*
+Times ExactCoverSolver on exact cover problems that have nothing to do with sudoku and checks the number of solutions found.
+Usage: ExactCoverBenchmark [queens|pentomino|langford]...   (all of them if none are given)
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <set>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include "../ExactCoverSolver.h"
+
+using namespace std;
+
+struct Problem
+{
+	string name;
+	int primaryColumns;
+	int secondaryColumns;
+	vector<vector<int>> rows;
+	long long expectedSolutions;
+};
+
+//Every queen is a row covering its rank and file (primary, every one has exactly one queen) and its two diagonals (secondary, at most one queen)
+Problem nQueens(int n, long long expectedSolutions)
+{
+	Problem problem{ to_string(n) + "-queens", n * 2, (n * 2 - 1) * 2, {}, expectedSolutions };
+	for (int rank = 0; rank < n; rank++) {
+		for (int file = 0; file < n; file++) {
+			problem.rows.push_back({ rank, n + file, n * 2 + rank + file, n * 2 + (n * 2 - 1) + rank - file + n - 1 });
+		}
+	}
+	return problem;
+}
+
+//Places each pair of the numbers 1 to n so the two copies of k have k numbers between them.
+//The columns are the numbers, then the 2n positions.
+Problem langford(int n, long long expectedSolutions)
+{
+	Problem problem{ "langford " + to_string(n), n * 3, 0, {}, expectedSolutions };
+	for (int k = 1; k <= n; k++) {
+		for (int first = 0; first + k + 1 < n * 2; first++) {
+			problem.rows.push_back({ k - 1, n + first, n + first + k + 1 });
+		}
+	}
+	return problem;
+}
+
+//Tiles a 6x10 rectangle with the 12 pentominoes. The columns are the pieces, then the 60 squares.
+//The X pentomino is kept in the lower left quarter, so every tiling is only counted once instead of once per way of turning the rectangle.
+Problem pentomino()
+{
+	const int height = 6;
+	const int width = 10;
+	const vector<vector<pair<int, int>>> pieces = {
+		{ {0,0},{0,1},{0,2},{0,3},{0,4} },	//I
+		{ {0,1},{1,0},{1,1},{1,2},{2,1} },	//X
+		{ {0,0},{0,1},{1,1},{1,2},{2,1} },	//F
+		{ {0,0},{1,0},{2,0},{3,0},{3,1} },	//L
+		{ {0,0},{1,0},{1,1},{2,1},{3,1} },	//N
+		{ {0,0},{0,1},{1,0},{1,1},{2,0} },	//P
+		{ {0,0},{0,1},{0,2},{1,1},{2,1} },	//T
+		{ {0,0},{0,2},{1,0},{1,1},{1,2} },	//U
+		{ {0,0},{1,0},{2,0},{2,1},{2,2} },	//V
+		{ {0,0},{1,0},{1,1},{2,1},{2,2} },	//W
+		{ {0,1},{1,0},{1,1},{2,1},{3,1} },	//Y
+		{ {0,0},{0,1},{1,1},{2,1},{2,2} },	//Z
+	};
+	const int xPiece = 1;
+
+	Problem problem{ "pentomino 6x10", 12 + height * width, 0, {}, 2339 };
+	for (int piece = 0; piece < (int)pieces.size(); piece++) {
+		//Every turn and flip of the piece, moved into the corner so the same shape always comes out the same
+		set<vector<pair<int, int>>> orientations;
+		for (int turn = 0; turn < 8; turn++) {
+			vector<pair<int, int>> shape;
+			for (pair<int, int> square : pieces[piece]) {
+				int row = square.first;
+				int col = square.second;
+				for (int i = 0; i < turn % 4; i++) {
+					swap(row, col);
+					col = -col;
+				}
+				if (turn >= 4)
+					col = -col;
+				shape.push_back({ row, col });
+			}
+			int minRow = min_element(shape.begin(), shape.end())->first;
+			int minCol = INT32_MAX;
+			for (pair<int, int>& square : shape) {
+				minCol = min(minCol, square.second);
+			}
+			for (pair<int, int>& square : shape) {
+				square.first -= minRow;
+				square.second -= minCol;
+			}
+			sort(shape.begin(), shape.end());
+			orientations.insert(shape);
+		}
+
+		for (const vector<pair<int, int>>& shape : orientations) {
+			for (int top = 0; top < height; top++) {
+				for (int left = 0; left < width; left++) {
+					if (piece == xPiece && (top * 2 + 3 > height || left * 2 + 3 > width))
+						continue;
+
+					vector<int> row{ piece };
+					for (pair<int, int> square : shape) {
+						int r = top + square.first;
+						int c = left + square.second;
+						if (r >= height || c >= width)
+							break;
+						row.push_back(12 + r * width + c);
+					}
+					if (row.size() == shape.size() + 1)
+						problem.rows.push_back(row);
+				}
+			}
+		}
+	}
+	return problem;
+}
+
+bool run(const Problem& problem)
+{
+	auto start = chrono::steady_clock::now();
+	ExactCoverSolver solver(problem.primaryColumns, problem.rows, problem.secondaryColumns);
+	auto built = chrono::steady_clock::now();
+	ExactCoverSolver::SearchResult result = solver.countSolutions();
+	auto end = chrono::steady_clock::now();
+
+	bool correct = result.solutionCount == problem.expectedSolutions;
+	cout << problem.name << ": " << result.solutionCount << " solutions" << (correct ? "" : " (expected " + to_string(problem.expectedSolutions) + ")")
+		<< ", " << result.nodes << " nodes, build " << chrono::duration<double, milli>(built - start).count() << " ms"
+		<< ", search " << chrono::duration<double, milli>(end - built).count() << " ms\n";
+	return correct;
+}
+
+int main(int argc, char* argv[])
+{
+	vector<string> chosen(argv + 1, argv + argc);
+	auto wanted = [&](const string& name) {
+		return chosen.empty() || find(chosen.begin(), chosen.end(), name) != chosen.end();
+	};
+
+	bool allCorrect = true;
+	if (wanted("queens")) {
+		allCorrect &= run(nQueens(8, 92));
+		allCorrect &= run(nQueens(10, 724));
+		allCorrect &= run(nQueens(12, 14200));
+	}
+	if (wanted("pentomino")) {
+		allCorrect &= run(pentomino());
+	}
+	if (wanted("langford")) {
+		//Every arrangement is counted along with its mirror image
+		allCorrect &= run(langford(7, 52));
+		allCorrect &= run(langford(8, 300));
+		allCorrect &= run(langford(11, 35584));
+	}
+
+	return allCorrect ? 0 : 1;
+}
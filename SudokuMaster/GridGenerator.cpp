@@ -0,0 +1,96 @@
+#include "GridGenerator.h"
+#include "ExactCover/BitHelper.h"
+
+GridGenerator::GridGenerator(uint32_t seed) :
+	random(seed)
+{
+	for (int cell = 0; cell < cellCount; cell++) {
+		cellBox[cell] = SudokuConstraints::boxOf(cell / size, cell % size);
+	}
+}
+
+void GridGenerator::seed(uint32_t seed)
+{
+	random.seed(seed);
+}
+
+void GridGenerator::generate(vector<vector<int>>& board)
+{
+	fill();
+
+	board.assign(size, vector<int>(size));
+	for (int cell = 0; cell < cellCount; cell++) {
+		board[cell / size][cell % size] = cells[cell];
+	}
+}
+
+void GridGenerator::fill()
+{
+	for (int i = 0; i < size; i++) {
+		rowUsed[i] = 0;
+		colUsed[i] = 0;
+		boxUsed[i] = 0;
+	}
+	for (int cell = 0; cell < cellCount; cell++) {
+		cells[cell] = 0;
+	}
+
+	int cell = 0;
+	untried[0] = allNumbers;
+	while (cell < cellCount) {
+		//Nothing left to try here, so take back the previous cell and try another of its numbers.
+		//Every partial grid can be completed by something, so this never backs up past the first cell.
+		if (untried[cell] == 0) {
+			cell--;
+			unplace(cell);
+			continue;
+		}
+
+		place(cell, takeRandom(untried[cell]));
+		cell++;
+
+		if (cell < cellCount) {
+			int row = cell / size;
+			int col = cell % size;
+			untried[cell] = ~(rowUsed[row] | colUsed[col] | boxUsed[cellBox[cell]]) & allNumbers;
+		}
+	}
+}
+
+int GridGenerator::takeRandom(uint16_t& mask)
+{
+	//Pick the nth remaining number, which gives every number the same chance wherever its bit is
+	int n = random() % BitHelper::popCount(mask);
+	uint16_t remaining = mask;
+	for (int i = 0; i < n; i++) {
+		remaining &= remaining - 1;
+	}
+
+	int bit = BitHelper::countTrailingZeros(remaining);
+	mask &= ~(1 << bit);
+	return bit + 1;
+}
+
+void GridGenerator::place(int cell, int num)
+{
+	uint16_t bit = 1 << (num - 1);
+	rowUsed[cell / size] |= bit;
+	colUsed[cell % size] |= bit;
+	boxUsed[cellBox[cell]] |= bit;
+	cells[cell] = num;
+
+	if (placementListener)
+		placementListener(cell, num);
+}
+
+void GridGenerator::unplace(int cell)
+{
+	uint16_t bit = ~(1 << (cells[cell] - 1));
+	rowUsed[cell / size] &= bit;
+	colUsed[cell % size] &= bit;
+	boxUsed[cellBox[cell]] &= bit;
+	cells[cell] = 0;
+
+	if (placementListener)
+		placementListener(cell, 0);
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <random>
+#include <functional>
+#include "SudokuConstraints.h"
+
+using namespace std;
+
+//Fills empty 9x9 boards with random complete sudoku grids.
+//The cells are filled in order, each with a random number out of what its row, column and outer square still allow (kept as bitmasks),
+//and when a cell has nothing left the search backs up to the previous cell and tries another of its numbers.
+//Nothing is copied or waited on, so a grid takes a few microseconds. The same seed always gives the same grids on every platform.
+class GridGenerator
+{
+public:
+	GridGenerator(uint32_t seed = 1);
+
+	void seed(uint32_t seed);
+
+	//Fills the board (resized to 9x9) with a new complete grid
+	void generate(vector<vector<int>>& board);
+
+	//Called every time a number is placed in a cell (row * 9 + col), or taken back out with num 0, if set.
+	//Only meant for watching the grid being built, it slows generation down considerably.
+	function<void(int cell, int num)> placementListener;
+
+private:
+	static constexpr int size = SudokuConstraints::size;
+	static constexpr int cellCount = SudokuConstraints::cellCount;
+	static constexpr uint16_t allNumbers = SudokuConstraints::allNumbers;
+
+	mt19937 random;
+
+	//Bit n - 1 is set if the number n has been placed in the row/column/outer square
+	uint16_t rowUsed[size];
+	uint16_t colUsed[size];
+	uint16_t boxUsed[size];
+
+	//The number in each cell, 0 if empty
+	uint8_t cells[cellCount];
+
+	//The numbers not tried yet in each cell up to the one being filled
+	uint16_t untried[cellCount];
+
+	//The outer square of every cell
+	uint8_t cellBox[cellCount];
+
+	//Fills cells with a complete grid
+	void fill();
+
+	//Removes a random number from the mask and returns it
+	int takeRandom(uint16_t& mask);
+
+	void place(int cell, int num);
+
+	void unplace(int cell);
+};
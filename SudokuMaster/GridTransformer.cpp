@@ -0,0 +1,82 @@
+#include "GridTransformer.h"
+
+GridTransformer::GridTransformer(uint32_t seed) :
+	random(seed)
+{
+	next();
+}
+
+void GridTransformer::seed(uint32_t seed)
+{
+	random.seed(seed);
+	next();
+}
+
+void GridTransformer::next()
+{
+	relabel[0] = 0;
+	for (int num = 1; num <= size; num++) {
+		relabel[num] = (uint8_t)num;
+	}
+	shuffle(relabel + 1, size);
+
+	uint8_t rowOrder[size];
+	uint8_t colOrder[size];
+	shuffleLines(rowOrder, boxRows);
+	shuffleLines(colOrder, boxCols);
+	bool mirror = (random() & 1) != 0;
+
+	for (int row = 0; row < size; row++) {
+		for (int col = 0; col < size; col++) {
+			int sourceRow = rowOrder[row];
+			int sourceCol = colOrder[col];
+			sourceCell[row * size + col] = (uint8_t)(mirror ? sourceCol * size + sourceRow : sourceRow * size + sourceCol);
+		}
+	}
+}
+
+void GridTransformer::apply(const vector<vector<int>>& board, vector<vector<int>>& transformed) const
+{
+	transformed.assign(size, vector<int>(size));
+	for (int cell = 0; cell < cellCount; cell++) {
+		int source = sourceCell[cell];
+		transformed[cell / size][cell % size] = relabel[board[source / size][source % size]];
+	}
+}
+
+void GridTransformer::apply(const uint8_t* board, uint8_t* transformed) const
+{
+	for (int cell = 0; cell < cellCount; cell++) {
+		transformed[cell] = relabel[board[sourceCell[cell]]];
+	}
+}
+
+void GridTransformer::shuffle(uint8_t* values, int count)
+{
+	//Fisher-Yates with our own random numbers, std::shuffle doesn't give the same order everywhere
+	for (int i = count - 1; i > 0; i--) {
+		int j = random() % (i + 1);
+		uint8_t swapped = values[i];
+		values[i] = values[j];
+		values[j] = swapped;
+	}
+}
+
+void GridTransformer::shuffleLines(uint8_t* order, int linesPerBand)
+{
+	const int bandCount = size / linesPerBand;
+
+	uint8_t bands[size];
+	for (int band = 0; band < bandCount; band++) {
+		bands[band] = (uint8_t)band;
+	}
+	shuffle(bands, bandCount);
+
+	for (int band = 0; band < bandCount; band++) {
+		uint8_t* lines = order + band * linesPerBand;
+		for (int line = 0; line < linesPerBand; line++) {
+			lines[line] = (uint8_t)(bands[band] * linesPerBand + line);
+		}
+		shuffle(lines, linesPerBand);
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <random>
+#include "SudokuConstraints.h"
+
+using namespace std;
+
+//Makes new 9x9 grids out of one that is already made, by moving it around in ways that keep every sudoku rule intact:
+//relabelling the numbers, swapping rows within a band of outer squares, columns within a stack, whole bands, whole stacks,
+//and mirroring along the diagonal. Empty cells stay empty, so a puzzle turns into a puzzle with the same number of solutions
+//and the same difficulty, just not looking like it. A new transformation is a few dozen random numbers and applying it is one
+//lookup per cell, so this gives millions of grids a second. The same seed always gives the same transformations on every platform.
+class GridTransformer
+{
+public:
+	static constexpr int size = SudokuConstraints::size;
+	static constexpr int cellCount = SudokuConstraints::cellCount;
+
+	GridTransformer(uint32_t seed = 1);
+
+	void seed(uint32_t seed);
+
+	//Picks a new random transformation, every one of them is as likely as any other
+	void next();
+
+	//Applies the current transformation to the board, the output is resized to 9x9. The same transformation can be applied
+	//to any number of boards, so a puzzle and its solution stay together.
+	void apply(const vector<vector<int>>& board, vector<vector<int>>& transformed) const;
+
+	//Same for a board stored as one number per cell, row by row. in and out can't be the same array.
+	void apply(const uint8_t* board, uint8_t* transformed) const;
+
+private:
+	static constexpr int boxRows = SudokuConstraints::boxRows;
+	static constexpr int boxCols = SudokuConstraints::boxCols;
+	static_assert(boxRows == boxCols, "Mirroring along the diagonal only keeps the outer squares when they are square");
+
+	mt19937 random;
+
+	//The cell of the original board every cell of the transformed board is taken from
+	uint8_t sourceCell[cellCount];
+
+	//The number every number is relabelled to, 0 (empty) stays 0
+	uint8_t relabel[size + 1];
+
+	//Shuffles the first count values in place
+	void shuffle(uint8_t* values, int count);
+
+	//Fills order with a random order of lines (rows or columns) that only moves lines within their band and whole bands
+	void shuffleLines(uint8_t* order, int linesPerBand);
+};
@@ -0,0 +1,123 @@
+#include "MappedFile.h"
+#include <string>
+#include <algorithm>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+MappedFile::MappedFile()
+{
+#ifdef _WIN32
+	char directory[MAX_PATH];
+	char path[MAX_PATH];
+	if (GetTempPathA(MAX_PATH, directory) == 0 || GetTempFileNameA(directory, "sdk", 0, path) == 0)
+		throw runtime_error("Could not name a temporary file");
+
+	HANDLE handle = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+		FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+	if (handle == INVALID_HANDLE_VALUE)
+		throw runtime_error(string("Could not create ") + path);
+	file = handle;
+#else
+	const char* directory = getenv("TMPDIR");
+	string path = string(directory ? directory : "/tmp") + "/sudokuXXXXXX";
+	file = mkstemp(&path[0]);
+	if (file < 0)
+		throw runtime_error("Could not create " + path);
+	//The file stays around until it is closed, but nobody else can find it
+	unlink(path.c_str());
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+	unmap();
+#ifdef _WIN32
+	CloseHandle(file);
+#else
+	close(file);
+#endif
+}
+
+void MappedFile::append(const uint8_t* bytes, size_t count)
+{
+	//Writes can come up short, so keep going until everything is written
+	while (count > 0) {
+#ifdef _WIN32
+		DWORD written = 0;
+		DWORD chunk = (DWORD)min(count, (size_t)1 << 30);
+		if (!WriteFile(file, bytes, chunk, &written, nullptr) || written == 0)
+			throw runtime_error("Could not write to the temporary file");
+#else
+		ssize_t written = write(file, bytes, count);
+		if (written <= 0)
+			throw runtime_error("Could not write to the temporary file");
+#endif
+		bytes += written;
+		count -= written;
+		fileSize += written;
+	}
+
+	//The mapping shows the writes as they happen, it only has to be redone once they run past the end of it
+	if (fileSize > mappedSize)
+		remap(max({ fileSize, 2 * mappedSize, minimumMapping }));
+}
+
+void MappedFile::remap(size_t length)
+{
+	unmap();
+
+	//Make the file long enough first, the writes carry on from the end of the bytes added so far
+#ifdef _WIN32
+	LARGE_INTEGER end;
+	end.QuadPart = (LONGLONG)length;
+	LARGE_INTEGER position;
+	position.QuadPart = (LONGLONG)fileSize;
+	if (!SetFilePointerEx(file, end, nullptr, FILE_BEGIN) || !SetEndOfFile(file) || !SetFilePointerEx(file, position, nullptr, FILE_BEGIN))
+		throw runtime_error("Could not grow the temporary file");
+
+	mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, (DWORD)((uint64_t)length >> 32), (DWORD)length, nullptr);
+	if (mappingHandle == nullptr)
+		throw runtime_error("Could not map the temporary file");
+	mapping = (const uint8_t*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, length);
+	if (mapping == nullptr) {
+		CloseHandle(mappingHandle);
+		mappingHandle = nullptr;
+		throw runtime_error("Could not map the temporary file");
+	}
+#else
+	if (ftruncate(file, (off_t)length) != 0)
+		throw runtime_error("Could not grow the temporary file");
+
+	void* address = mmap(nullptr, length, PROT_READ, MAP_SHARED, file, 0);
+	if (address == MAP_FAILED)
+		throw runtime_error("Could not map the temporary file");
+	mapping = (const uint8_t*)address;
+#endif
+
+	mappedSize = length;
+}
+
+void MappedFile::unmap()
+{
+	if (mapping == nullptr)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(mapping);
+	CloseHandle(mappingHandle);
+	mappingHandle = nullptr;
+#else
+	munmap((void*)mapping, mappedSize);
+#endif
+
+	mapping = nullptr;
+	mappedSize = 0;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+
+using namespace std;
+
+//A temporary file that can only be added to, and read back through a read-only memory mapping.
+//The file is deleted as soon as it is closed. Throws runtime_error if the file can't be created, written or mapped.
+//The file is grown and mapped again by append, doubling each time it runs out of room, so reading never changes anything.
+//Any number of threads can read at once, but nothing may read while a thread appends, and append moves the data.
+class MappedFile
+{
+public:
+	MappedFile();
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	//Adds the bytes to the end of the file, mapping it again if it has grown past the end of the mapping
+	void append(const uint8_t* bytes, size_t count);
+
+	//Returns the start of the file in memory, or nullptr if nothing has been added yet. Only valid until the next append.
+	const uint8_t* data() const { return mapping; }
+
+	size_t size() const { return fileSize; }
+
+private:
+	//The bytes that have been added, the file itself is made longer ahead of time so it can be mapped less often
+	size_t fileSize = 0;
+
+	const uint8_t* mapping = nullptr;
+	size_t mappedSize = 0;
+
+	//The file is never mapped in steps smaller than this
+	static constexpr size_t minimumMapping = 1 << 20;
+
+#ifdef _WIN32
+	void* file = nullptr;
+	void* mappingHandle = nullptr;
+#else
+	int file = -1;
+#endif
+
+	//Makes the file at least length bytes long and maps all of it
+	void remap(size_t length);
+
+	void unmap();
+};
@@ -0,0 +1,181 @@
+#include "ParallelSolver.h"
+#include "SudokuConstraints.h"
+#include "ExactCover/BitHelper.h"
+#include "ThreadHelper.h"
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <algorithm>
+
+ParallelSolver::ParallelSolver(unsigned threadCount)
+{
+	setThreadCount(threadCount);
+	finishedSolutions = 0;
+	reportingProgress = false;
+}
+
+ParallelSolver::SearchResult ParallelSolver::solve(const vector<vector<int>>& puzzle, SolutionStore& solutions, long long maxSolutions, bool showProgress)
+{
+	return search(puzzle, &solutions, maxSolutions, showProgress);
+}
+
+ParallelSolver::SearchResult ParallelSolver::countSolutions(const vector<vector<int>>& puzzle, long long maxSolutions)
+{
+	return search(puzzle, nullptr, maxSolutions, false);
+}
+
+void ParallelSolver::setThreadCount(unsigned threadCount)
+{
+	this->threadCount = ThreadHelper::resolveThreadCount(threadCount);
+}
+
+unsigned ParallelSolver::getThreadCount()
+{
+	return threadCount;
+}
+
+ParallelSolver::SearchResult ParallelSolver::search(const vector<vector<int>>& puzzle, SolutionStore* solutions, long long maxSolutions, bool showProgress)
+{
+	//Nothing to split up, or the search is meant to stop early, so one thread does it all
+	if (threadCount == 1 || maxSolutions > 0) {
+		serialSolver.progressListener = progressListener;
+		if (solutions)
+			return serialSolver.solve(puzzle, *solutions, maxSolutions, showProgress);
+		return serialSolver.countSolutions(puzzle, maxSolutions);
+	}
+
+	SearchResult result{ 0, false };
+
+	//Fill in the forced cells first so the splitting starts at a real branch point
+	vector<vector<int>> reduced = puzzle;
+	if (!propagator.propagate(reduced))
+		return result;
+
+	vector<vector<vector<int>>> tasks = split(reduced, threadCount * tasksPerThread);
+
+	if (workers.size() < threadCount)
+		workers.resize(threadCount);
+
+	//Every thread reports progress through the same listener, one at a time. A thread that finds another one in the listener
+	//skips its report rather than waiting, so a slow listener (the window sleeps in it) only holds up the thread calling it.
+	finishedSolutions = 0;
+	reportingProgress = false;
+	for (SudokuSolver& worker : workers) {
+		worker.progressListener = [this](const vector<vector<int>>& board, long long nSolutions) {
+			if (!progressListener || reportingProgress.exchange(true))
+				return;
+			progressListener(board, finishedSolutions + nSolutions);
+			reportingProgress = false;
+		};
+	}
+
+	//There is no point in starting more threads than there are subpuzzles
+	size_t threadsUsed = min((size_t)threadCount, tasks.size());
+
+	//Each subpuzzle gets its own slot for its results so the threads never write to the same place.
+	//A finished slot is joined onto the solutions as soon as every subpuzzle before it has been, and then emptied.
+	vector<SolutionStore> taskSolutions(tasks.size());
+	vector<long long> taskCounts(tasks.size(), 0);
+	vector<bool> taskDone(tasks.size(), false);
+	size_t nextTask = 0;
+	size_t nextMerge = 0;
+
+	//With a memory limit only a few subpuzzles past the oldest unjoined one may be started, and they split the limit
+	//between them. So at any time the subpuzzles keep no more in memory than the solutions would, and only a few of them
+	//can have spilled to a temporary file.
+	size_t window = tasks.size();
+	if (solutions && solutions->getMemoryLimit() > 0) {
+		window = 2 * threadsUsed;
+		for (SolutionStore& store : taskSolutions) {
+			store.setMemoryLimit(max(solutions->getMemoryLimit() / window, (size_t)SolutionStore::bytesPerBoard));
+		}
+	}
+
+	mutex taskMutex;
+	condition_variable taskMerged;
+	//The first exception thrown by a thread. The others stop taking subpuzzles, and it is thrown again once they are all done.
+	exception_ptr failure;
+
+	auto work = [&](SudokuSolver& worker) {
+		try {
+			while (true) {
+				//Take the next subpuzzle nobody has started on, if it is close enough to the ones being joined
+				size_t task;
+				{
+					unique_lock<mutex> lock(taskMutex);
+					taskMerged.wait(lock, [&]() { return failure || nextTask == tasks.size() || nextTask < nextMerge + window; });
+					if (failure || nextTask == tasks.size())
+						return;
+					task = nextTask++;
+				}
+
+				SearchResult taskResult = solutions ?
+					worker.solve(tasks[task], taskSolutions[task], 0, showProgress) :
+					worker.countSolutions(tasks[task]);
+				finishedSolutions += taskResult.solutionCount;
+
+				//Join every finished subpuzzle that is next in line
+				lock_guard<mutex> lock(taskMutex);
+				taskCounts[task] = taskResult.solutionCount;
+				taskDone[task] = true;
+				for (; nextMerge < tasks.size() && taskDone[nextMerge]; nextMerge++) {
+					result.solutionCount += taskCounts[nextMerge];
+					if (solutions) {
+						solutions->append(taskSolutions[nextMerge]);
+						taskSolutions[nextMerge].clear();
+					}
+				}
+				taskMerged.notify_all();
+			}
+		}
+		catch (...) {
+			lock_guard<mutex> lock(taskMutex);
+			if (!failure)
+				failure = current_exception();
+			taskMerged.notify_all();
+		}
+	};
+
+	ThreadHelper::runOnThreads(threadsUsed, [&](size_t index) { work(workers[index]); });
+
+	if (failure)
+		rethrow_exception(failure);
+
+	return result;
+}
+
+vector<vector<vector<int>>> ParallelSolver::split(const vector<vector<int>>& puzzle, size_t taskCount)
+{
+	vector<vector<vector<int>>> tasks{ puzzle };
+
+	while (tasks.size() < taskCount) {
+		vector<vector<vector<int>>> nextTasks;
+		bool splitAny = false;
+
+		for (vector<vector<int>>& task : tasks) {
+			int row, col;
+			SinglesPropagator::Mask candidates;
+			//A full subpuzzle is already a solution, keep it as it is
+			if (!propagator.mostConstrainedCell(task, row, col, candidates)) {
+				nextTasks.push_back(move(task));
+				continue;
+			}
+
+			//One subpuzzle per candidate from the lowest number up, the ones that can't be solved are dropped
+			splitAny = true;
+			for (; candidates != 0; candidates &= candidates - 1) {
+				vector<vector<int>> child = task;
+				child[row][col] = BitHelper::countTrailingZeros(candidates) + 1;
+				if (propagator.propagate(child))
+					nextTasks.push_back(move(child));
+			}
+		}
+
+		tasks = move(nextTasks);
+		//Every subpuzzle is already solved
+		if (!splitAny)
+			break;
+	}
+
+	return tasks;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include "SolverEngine.h"
+#include "SudokuSolver.h"
+#include "SinglesPropagator.h"
+
+using namespace std;
+
+//Enumerates the solutions of weakly constrained puzzles on every core.
+//The search tree is split at its shallowest branch points into subpuzzles, each of which fills in one more cell than its parent.
+//The subpuzzles go into one shared list that idle threads take the next one from (there is no work stealing, the subpuzzles
+//are all made up front), each thread with its own SudokuSolver (and so its own copy of the exact cover matrix).
+//Each subpuzzle keeps its solutions to itself until every subpuzzle before it has been joined onto the solutions, so the order
+//of the solutions never depends on the timing of the threads. An exception in any thread is thrown again from solve.
+class ParallelSolver : public SolverEngine
+{
+public:
+	//A thread count of 0 uses one thread per hardware thread
+	ParallelSolver(unsigned threadCount = 0);
+
+	//Searches that stop after maxSolutions solutions are run on a single thread, since they are usually over long before splitting pays off
+	SearchResult solve(const vector<vector<int>>& puzzle, SolutionStore& solutions, long long maxSolutions = 0, bool showProgress = false) override;
+
+	SearchResult countSolutions(const vector<vector<int>>& puzzle, long long maxSolutions = 0) override;
+
+	void setThreadCount(unsigned threadCount);
+
+	unsigned getThreadCount();
+
+private:
+	unsigned threadCount;
+
+	//Runs the limited searches and everything when there is only one thread
+	SudokuSolver serialSolver;
+
+	//One solver per worker thread, only built the first time they are needed
+	vector<SudokuSolver> workers;
+
+	SinglesPropagator propagator;
+
+	//Set while one of the threads is calling progressListener
+	atomic<bool> reportingProgress;
+
+	//The number of solutions found by the subpuzzles that are finished, used when reporting progress
+	atomic<long long> finishedSolutions;
+
+	//How many subpuzzles to aim for per thread, so a thread that gets easy ones can keep taking more
+	static constexpr int tasksPerThread = 16;
+
+	SearchResult search(const vector<vector<int>>& puzzle, SolutionStore* solutions, long long maxSolutions, bool showProgress);
+
+	//Splits the puzzle into subpuzzles whose solutions together are exactly the solutions of the puzzle.
+	//Every round replaces each subpuzzle by one per candidate of its most constrained cell, until there are at least taskCount of them.
+	vector<vector<vector<int>>> split(const vector<vector<int>>& puzzle, size_t taskCount);
+};
@@ -0,0 +1,195 @@
+#include "SinglesPropagator.h"
+#include "ExactCover/BitHelper.h"
+#include <algorithm>
+
+template <class Geometry>
+BasicSinglesPropagator<Geometry>::BasicSinglesPropagator(const BasicConstraintModel<Geometry>& model)
+{
+	for (const vector<int>& unit : model.getUnits()) {
+		unitCells.insert(unitCells.end(), unit.begin(), unit.end());
+	}
+	unitUsed.resize(model.getUnits().size());
+
+	vector<vector<int>> unitsOfCell = model.cellUnits();
+	for (int cell = 0; cell < cellCount; cell++) {
+		cellUnitStart[cell] = cellUnitList.size();
+		cellUnitList.insert(cellUnitList.end(), unitsOfCell[cell].begin(), unitsOfCell[cell].end());
+	}
+	cellUnitStart[cellCount] = cellUnitList.size();
+}
+
+template <class Geometry>
+bool BasicSinglesPropagator<Geometry>::propagate(vector<vector<int>>& puzzle)
+{
+	if (!load(puzzle))
+		return false;
+
+	//Keep placing singles until a whole pass doesn't find any more
+	bool changed = true;
+	while (changed) {
+		int naked = placeNakedSingles();
+		if (naked < 0)
+			return false;
+
+		int hidden = placeHiddenSingles();
+		if (hidden < 0)
+			return false;
+
+		changed = naked + hidden > 0;
+	}
+
+	for (int cell = 0; cell < cellCount; cell++) {
+		puzzle[cell / size][cell % size] = board[cell];
+	}
+
+	return true;
+}
+
+template <class Geometry>
+bool BasicSinglesPropagator<Geometry>::load(const vector<vector<int>>& puzzle)
+{
+	fill(unitUsed.begin(), unitUsed.end(), 0);
+
+	for (int row = 0; row < size; row++) {
+		for (int col = 0; col < size; col++) {
+			int cell = row * size + col;
+			int num = puzzle[row][col];
+			board[cell] = 0;
+			if (num == 0)
+				continue;
+
+			//The number has to still be a candidate, otherwise it repeats in one of its units
+			if (!(candidates(cell) & ((Mask)1 << (num - 1))))
+				return false;
+			place(cell, num);
+		}
+	}
+
+	return true;
+}
+
+template <class Geometry>
+int BasicSinglesPropagator<Geometry>::placeNakedSingles()
+{
+	int placed = 0;
+
+	for (int cell = 0; cell < cellCount; cell++) {
+		if (board[cell] != 0)
+			continue;
+
+		Mask cellCandidates = candidates(cell);
+
+		//Nothing fits in this cell anymore
+		if (cellCandidates == 0)
+			return -1;
+
+		//Only one number fits, so it has to go here
+		if ((cellCandidates & (cellCandidates - 1)) == 0) {
+			place(cell, BitHelper::countTrailingZeros(cellCandidates) + 1);
+			placed++;
+		}
+	}
+
+	return placed;
+}
+
+template <class Geometry>
+int BasicSinglesPropagator<Geometry>::placeHiddenSingles()
+{
+	int placed = 0;
+
+	for (size_t unit = 0; unit < unitUsed.size(); unit++) {
+		const uint16_t* cells = &unitCells[unit * size];
+
+		//Collect the numbers that fit in at least one and at least two cells, along with the ones already placed
+		Mask once = 0;
+		Mask twice = 0;
+		Mask used = 0;
+		for (int i = 0; i < size; i++) {
+			int cell = cells[i];
+			if (board[cell] != 0) {
+				used |= (Mask)1 << (board[cell] - 1);
+				continue;
+			}
+
+			Mask cellCandidates = candidates(cell);
+			twice |= once & cellCandidates;
+			once |= cellCandidates;
+		}
+
+		//Every number has to either be placed in the unit already or still fit somewhere in it
+		if ((once | used) != allNumbers)
+			return -1;
+
+		//Place each number that only fits in one cell of the unit
+		Mask singles = once & ~twice;
+		while (singles != 0) {
+			int num = BitHelper::countTrailingZeros(singles) + 1;
+			Mask bit = (Mask)1 << (num - 1);
+			singles &= singles - 1;
+
+			for (int i = 0; i < size; i++) {
+				int cell = cells[i];
+				//An earlier single may have taken the cell or ruled the number out, the next pass will sort that out
+				if (board[cell] == 0 && (candidates(cell) & bit)) {
+					place(cell, num);
+					placed++;
+					break;
+				}
+			}
+		}
+	}
+
+	return placed;
+}
+
+template <class Geometry>
+bool BasicSinglesPropagator<Geometry>::mostConstrainedCell(const vector<vector<int>>& puzzle, int& bestRow, int& bestCol, Mask& bestCandidates)
+{
+	if (!load(puzzle))
+		return false;
+
+	int bestCount = size + 1;
+	for (int cell = 0; cell < cellCount; cell++) {
+		if (board[cell] != 0)
+			continue;
+
+		Mask cellCandidates = candidates(cell);
+		int count = BitHelper::popCount(cellCandidates);
+		if (count < bestCount) {
+			bestRow = cell / size;
+			bestCol = cell % size;
+			bestCandidates = cellCandidates;
+			bestCount = count;
+		}
+	}
+
+	return bestCount <= size;
+}
+
+template <class Geometry>
+typename BasicSinglesPropagator<Geometry>::Mask BasicSinglesPropagator<Geometry>::candidates(int cell) const
+{
+	Mask used = 0;
+	for (int i = cellUnitStart[cell]; i < cellUnitStart[cell + 1]; i++) {
+		used |= unitUsed[cellUnitList[i]];
+	}
+	return ~used & allNumbers;
+}
+
+template <class Geometry>
+void BasicSinglesPropagator<Geometry>::place(int cell, int num)
+{
+	Mask bit = (Mask)1 << (num - 1);
+	for (int i = cellUnitStart[cell]; i < cellUnitStart[cell + 1]; i++) {
+		unitUsed[cellUnitList[i]] |= bit;
+	}
+	board[cell] = num;
+}
+
+//The board sizes the propagator is built for
+template class BasicSinglesPropagator<Board<2, 2>>;
+template class BasicSinglesPropagator<Board<2, 3>>;
+template class BasicSinglesPropagator<Board<3, 3>>;
+template class BasicSinglesPropagator<Board<4, 4>>;
+template class BasicSinglesPropagator<Board<5, 5>>;
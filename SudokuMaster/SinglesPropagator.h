@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "SudokuConstraints.h"
+#include "ConstraintModel.h"
+
+using namespace std;
+
+//Fills in the cells of a sudoku that are forced by naked singles (a cell with one candidate left)
+//and hidden singles (a number that only fits in one cell of a row, column, outer square or any other unit of the model).
+//Placing a forced number can force others, so it keeps going until nothing changes.
+//Most puzzles are solved completely this way, the rest leave the exact cover search far less to do.
+template <class Geometry>
+class BasicSinglesPropagator
+{
+public:
+	BasicSinglesPropagator(const BasicConstraintModel<Geometry>& model = BasicConstraintModel<Geometry>());
+
+	//Fills every forced cell of the puzzle in place.
+	//Returns false if the puzzle turns out to have no solution, in which case the puzzle is left partly filled.
+	bool propagate(vector<vector<int>>& puzzle);
+
+	using Mask = typename Geometry::Mask;
+
+	//Finds the empty cell with the fewest candidates under the units of the model, the first one in row order if there is a tie,
+	//and returns its candidates as a mask. Returns false if the puzzle is full or two givens clash.
+	bool mostConstrainedCell(const vector<vector<int>>& puzzle, int& bestRow, int& bestCol, Mask& bestCandidates);
+
+private:
+	static constexpr int size = Geometry::size;
+	static constexpr int cellCount = Geometry::cellCount;
+	static constexpr Mask allNumbers = Geometry::allNumbers;
+
+	//Bit n - 1 is set if the number n has been placed in the unit
+	vector<Mask> unitUsed;
+
+	//The number in each cell, 0 if empty
+	uint8_t board[cellCount];
+
+	//The cells of every unit of the model, size cells per unit one after the other
+	vector<uint16_t> unitCells;
+
+	//The units of every cell, those of the cell n are cellUnitList[cellUnitStart[n]] up to cellUnitList[cellUnitStart[n + 1]]
+	uint16_t cellUnitStart[cellCount + 1];
+	vector<uint16_t> cellUnitList;
+
+	//Loads the puzzle into the masks. Returns false if two givens clash.
+	bool load(const vector<vector<int>>& puzzle);
+
+	//Places every naked single. Returns -1 on a contradiction, otherwise the number of cells filled.
+	int placeNakedSingles();
+
+	//Places every hidden single. Returns -1 on a contradiction, otherwise the number of cells filled.
+	int placeHiddenSingles();
+
+	//Returns the numbers that can still go in the cell as a mask
+	Mask candidates(int cell) const;
+
+	void place(int cell, int num);
+};
+
+using SinglesPropagator = BasicSinglesPropagator<SudokuConstraints>;
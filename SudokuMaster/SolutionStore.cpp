@@ -0,0 +1,94 @@
+#include "SolutionStore.h"
+#include <algorithm>
+
+template <class Geometry>
+void BasicSolutionStore<Geometry>::add(const vector<vector<int>>& board)
+{
+	uint8_t cells[bytesPerBoard] = {};
+	for (int cell = 0; cell < cellCount; cell++) {
+		uint8_t num = board[cell / Geometry::size][cell % Geometry::size];
+		//Even cells go in the low half of the byte, odd cells in the high half
+		if (packed)
+			cells[cell / 2] |= cell % 2 == 0 ? num : num << 4;
+		else
+			cells[cell] = num;
+	}
+
+	addPacked(cells);
+}
+
+template <class Geometry>
+void BasicSolutionStore<Geometry>::append(const BasicSolutionStore& other)
+{
+	//Both lists in memory, so the whole buffer can be copied at once
+	if (!spilled() && !other.spilled() && (memoryLimit == 0 || data.size() + other.data.size() <= memoryLimit)) {
+		data.insert(data.end(), other.data.begin(), other.data.end());
+		boardCount += other.boardCount;
+		return;
+	}
+
+	for (size_t i = 0; i < other.size(); i++) {
+		addPacked(other.packedBoard(i));
+	}
+}
+
+template <class Geometry>
+void BasicSolutionStore<Geometry>::clear()
+{
+	data.clear();
+	boardCount = 0;
+	spillFile.reset();
+	spilledCount = 0;
+}
+
+template <class Geometry>
+vector<vector<int>> BasicSolutionStore<Geometry>::board(size_t index) const
+{
+	vector<vector<int>> board(Geometry::size, vector<int>(Geometry::size));
+	for (int row = 0; row < Geometry::size; row++) {
+		for (int col = 0; col < Geometry::size; col++) {
+			board[row][col] = get(index, row, col);
+		}
+	}
+	return board;
+}
+
+template <class Geometry>
+const uint8_t* BasicSolutionStore<Geometry>::packedBoard(size_t index) const
+{
+	if (index < spilledCount)
+		return spillFile->data() + index * bytesPerBoard;
+	return &data[(index - spilledCount) * bytesPerBoard];
+}
+
+template <class Geometry>
+void BasicSolutionStore<Geometry>::addPacked(const uint8_t* board)
+{
+	//The next board would go over the limit, so from now on the boards live in a temporary file
+	if (!spilled() && memoryLimit > 0 && data.size() + bytesPerBoard > memoryLimit) {
+		spillFile = make_unique<MappedFile>();
+		flush();
+	}
+
+	data.insert(data.end(), board, board + bytesPerBoard);
+	boardCount++;
+
+	//Keep the boards waiting to be written under the limit too
+	if (spilled() && data.size() >= min(writeBlockSize, memoryLimit))
+		flush();
+}
+
+template <class Geometry>
+void BasicSolutionStore<Geometry>::flush()
+{
+	spillFile->append(data.data(), data.size());
+	spilledCount += data.size() / bytesPerBoard;
+	data.clear();
+}
+
+//The board sizes the solution store is built for
+template class BasicSolutionStore<Board<2, 2>>;
+template class BasicSolutionStore<Board<2, 3>>;
+template class BasicSolutionStore<Board<3, 3>>;
+template class BasicSolutionStore<Board<4, 4>>;
+template class BasicSolutionStore<Board<5, 5>>;
@@ -0,0 +1,84 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include "SudokuConstraints.h"
+#include "MappedFile.h"
+
+using namespace std;
+
+//Keeps a list of solved boards in one contiguous buffer.
+//On boards up to 15x15 every number fits in 4 bits, so two cells are packed into each byte (41 bytes for a 9x9 board)
+//instead of 81 ints spread over ten separate allocations. Bigger boards take one byte per cell.
+//Once the boards would take up more memory than the memory limit, every board is moved to a temporary file and new boards
+//are added to the end of it. The file is read back through a memory mapping, so reading works the same either way.
+//Reading never changes the store, so any number of threads can read at once as long as none of them adds boards at the same time.
+template <class Geometry>
+class BasicSolutionStore
+{
+public:
+	static constexpr int cellCount = Geometry::cellCount;
+	static constexpr bool packed = Geometry::size <= 15;
+	static constexpr int bytesPerBoard = packed ? (cellCount + 1) / 2 : cellCount;
+
+	//Adds a copy of the board to the end of the list
+	void add(const vector<vector<int>>& board);
+
+	//Adds every board of other to the end of the list
+	void append(const BasicSolutionStore& other);
+
+	size_t size() const { return boardCount; }
+
+	bool empty() const { return boardCount == 0; }
+
+	//Removes every board, and the temporary file if there is one
+	void clear();
+
+	//Returns the number at row/col of the board at index
+	int get(size_t index, int row, int col) const
+	{
+		int cell = row * Geometry::size + col;
+		if (!packed)
+			return packedBoard(index)[cell];
+
+		uint8_t pair = packedBoard(index)[cell / 2];
+		//Even cells are in the low half of the byte, odd cells in the high half
+		return cell % 2 == 0 ? pair & 0x0F : pair >> 4;
+	}
+
+	//Unpacks the board at index
+	vector<vector<int>> board(size_t index) const;
+
+	//Sets how many bytes of boards are kept in memory before they go to a temporary file. 0 means there is no limit.
+	void setMemoryLimit(size_t bytes) { memoryLimit = bytes; }
+
+	size_t getMemoryLimit() const { return memoryLimit; }
+
+	//Returns true if the boards have been moved to a temporary file
+	bool spilled() const { return spillFile != nullptr; }
+
+private:
+	//The boards in memory. Once spilled, only the boards that haven't been written to the file yet.
+	vector<uint8_t> data;
+	size_t boardCount = 0;
+
+	size_t memoryLimit = 0;
+
+	//The temporary file holding the first spilledCount boards, if the memory limit has been reached
+	unique_ptr<MappedFile> spillFile;
+	size_t spilledCount = 0;
+
+	//Boards are written to the file in blocks of this many bytes rather than one at a time
+	static constexpr size_t writeBlockSize = 1 << 20;
+
+	//Returns the packed cells of the board at index
+	const uint8_t* packedBoard(size_t index) const;
+
+	//Adds an already packed board to the end of the list
+	void addPacked(const uint8_t* board);
+
+	//Writes the boards in memory to the end of the file
+	void flush();
+};
+
+using SolutionStore = BasicSolutionStore<SudokuConstraints>;
@@ -0,0 +1,38 @@
+#include "SolverEngine.h"
+#include <iostream>
+#include <cstring>
+
+bool parseEngineType(const string& name, EngineType& type)
+{
+	if (name == "algorithmX")
+		type = EngineType::algorithmX;
+	else if (name == "bitboard")
+		type = EngineType::bitboard;
+	else if (name == "parallel")
+		type = EngineType::parallelAlgorithmX;
+	else
+		return false;
+	return true;
+}
+
+bool takeEngineOption(int& argc, char* argv[], EngineType& type)
+{
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--engine") != 0)
+			continue;
+
+		if (i + 1 >= argc || !parseEngineType(argv[i + 1], type)) {
+			cerr << "--engine takes one of algorithmX, bitboard or parallel\n";
+			return false;
+		}
+
+		//Shift the rest of the arguments down over the option
+		for (int j = i; j + 2 < argc; j++) {
+			argv[j] = argv[j + 2];
+		}
+		argc -= 2;
+		return true;
+	}
+
+	return true;
+}
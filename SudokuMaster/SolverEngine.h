@@ -0,0 +1,50 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <functional>
+#include "SolutionStore.h"
+
+using namespace std;
+
+//The interface shared by every engine that can solve a sudoku of the given Board size, so callers can pick one at runtime
+template <class Geometry>
+class BasicSolverEngine
+{
+public:
+	virtual ~BasicSolverEngine() = default;
+
+	struct SearchResult
+	{
+		//The number of solutions found
+		long long solutionCount;
+		//True if the search stopped because it found maxSolutions solutions, so there may be more
+		bool limitReached;
+	};
+
+	//Finds the solutions of the puzzle and adds each one to the end of solutions as a complete board.
+	//The search stops after maxSolutions solutions, or runs to the end if it is 0.
+	//progressListener is only called if showProgress is true.
+	virtual SearchResult solve(const vector<vector<int>>& puzzle, BasicSolutionStore<Geometry>& solutions, long long maxSolutions = 0, bool showProgress = false) = 0;
+
+	//Counts the solutions of the puzzle without storing any of them.
+	//The count stops at maxSolutions, or runs to the end if it is 0.
+	virtual SearchResult countSolutions(const vector<vector<int>>& puzzle, long long maxSolutions = 0) = 0;
+
+	//Called with the partially solved board every time the engine tries a value while solving,
+	//along with the number of solutions found so far.
+	function<void(const vector<vector<int>>&, long long)> progressListener;
+};
+
+using SolverEngine = BasicSolverEngine<SudokuConstraints>;
+
+//The engines that can solve 9x9 puzzles, so callers can pick one at runtime.
+//With algorithmX the solutions can be found one at a time as they are asked for, the others find every solution up front.
+enum class EngineType { algorithmX, bitboard, parallelAlgorithmX };
+
+//Turns the name of an engine as written on the command line (algorithmX, bitboard or parallel) into its type.
+//Returns false if it isn't one of them.
+bool parseEngineType(const string& name, EngineType& type);
+
+//Takes "--engine <name>" out of the command line arguments, if it is there, and sets type to it.
+//Returns false and prints why to stderr if the name is missing or isn't an engine.
+bool takeEngineOption(int& argc, char* argv[], EngineType& type);
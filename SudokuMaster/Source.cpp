@@ -26,6 +26,7 @@ using namespace std;
 #include "ColorHelper.h"
 #include "SudokuMaster.h"
 #include "InvalidPuzzleException.h"
+#include "BatchSolver.h"
 
 void leaveStage(short oldStage, vector<shared_ptr<Button>> stageButtons[]);
 
@@ -33,8 +34,16 @@ void enterStage(short newStage, vector<shared_ptr<Button>> stageButtons[]);
 
 void changeStage(short newStage, short oldStage, vector<shared_ptr<Button>> stageButtons[]);
 
-int main()
+int main(int argc, char* argv[])
 {
+    //Solve a whole file of puzzles without opening the window, the same as sudoku-cli batch
+    if (argc >= 2 && string(argv[1]) == "--batch") {
+        EngineType engine = EngineType::algorithmX;
+        if (!takeEngineOption(argc, argv, engine))
+            return 1;
+        return BatchSolver::runCommand(vector<string>(argv + 2, argv + argc), engine, string(argv[0]) + " --batch <input> <output> [threads] [--engine algorithmX|bitboard|parallel]");
+    }
+
     //Seed the random number generator
     srand(time(0));
 
@@ -181,6 +190,26 @@ int main()
     }
     master.registerContainer(mouseListeners);
 
+    //A menu button that switches between the solvers used for generating and solving, Algorithm X -> Bitboard -> Parallel and around again
+    shared_ptr<Button> engineButton;
+    engineButton = make_shared<Button>(font, 28, "Engine: Algorithm X", ColorHelper::AlmostBlack, sf::Color::White, 50, 460, 200, 40,
+        [&]() {
+            if (master.getEngine() == SudokuMaster::Engine::algorithmX) {
+                master.setEngine(SudokuMaster::Engine::bitboard);
+                engineButton->setLabel("Engine: Bitboard");
+            }
+            else if (master.getEngine() == SudokuMaster::Engine::bitboard) {
+                master.setEngine(SudokuMaster::Engine::parallelAlgorithmX);
+                engineButton->setLabel("Engine: Parallel");
+            }
+            else {
+                master.setEngine(SudokuMaster::Engine::algorithmX);
+                engineButton->setLabel("Engine: Algorithm X");
+            }
+        });
+    stageButtons[0].push_back(engineButton);
+    mouseListeners.push_back(engineButton);
+
 
     //Loading Difficulty screen
     stageTexts[1].push_back(make_shared<sf::Text>("Choose your difficulty", font, 30));
@@ -292,6 +321,17 @@ int main()
     y += 80;
     mouseListeners.push_back(stageButtons[3].back());
 
+    //Same puzzle with its numbers relabelled and its rows and columns moved around, so there is no wait for a new one
+    stageButtons[3].push_back(make_shared<Button>(font, 28, "Play Shuffled", ColorHelper::AlmostBlack, sf::Color::White, 75, y, 130, 40,
+        [&]() {
+            if (master.shuffleSudokuPuzzle()) {
+                changeStage(2, 3, stageButtons);
+                programStage = 2;
+            }
+        }));
+    y += 80;
+    mouseListeners.push_back(stageButtons[3].back());
+
     stageButtons[3].push_back(make_shared<Button>(font, 28, "Change Difficulty", ColorHelper::AlmostBlack, sf::Color::Yellow, 60, y, 170, 40,
         [&]() {
             master.wipeData();
@@ -408,7 +448,7 @@ int main()
     stageButtons[5].push_back(make_shared<Button>(font, 28, "Next", ColorHelper::AlmostBlack, ColorHelper::LightBlue, 800, 710, 50, 40,
         [&]() {
             master.rotateSolution(true);
-            solutionCountText->setString("Viewing solution " + to_string(master.getSolutionIndex() + 1) + " of " + to_string(master.solutionsFound()));
+            solutionCountText->setString("Viewing solution " + to_string(master.getSolutionIndex() + 1) + " of " + to_string(master.solutionsFound()) + (master.allSolutionsFound() ? "" : "+"));
             sf::Rect<float> textBounds = solutionCountText->getLocalBounds();
             //Center text
             solutionCountText->setOrigin(textBounds.width / 2.f, 0);
@@ -420,7 +460,7 @@ int main()
     stageButtons[5].push_back(make_shared<Button>(font, 28, "Previous", ColorHelper::AlmostBlack, ColorHelper::Orange, 135, 710, 80, 40,
         [&]() {
             master.rotateSolution(false);
-            solutionCountText->setString("Viewing solution " + to_string(master.getSolutionIndex() + 1) + " of " + to_string(master.solutionsFound()));
+            solutionCountText->setString("Viewing solution " + to_string(master.getSolutionIndex() + 1) + " of " + to_string(master.solutionsFound()) + (master.allSolutionsFound() ? "" : "+"));
             sf::Rect<float> textBounds = solutionCountText->getLocalBounds();
             //Center text
             solutionCountText->setOrigin(textBounds.width / 2.f, 0);
@@ -438,7 +478,7 @@ int main()
     stageButtons[5].back()->bindSetupFunction([&](Button* b) {
             //Change texts for this stage depending on the amount of solutions
             if (master.solutionsFound() > 1) {
-                solutionCountText->setString("Viewing solution " + to_string(master.getSolutionIndex() + 1) + " of " + to_string(master.solutionsFound()));
+                solutionCountText->setString("Viewing solution " + to_string(master.getSolutionIndex() + 1) + " of " + to_string(master.solutionsFound()) + (master.allSolutionsFound() ? "" : "+"));
                 sf::Rect<float> textBounds = solutionCountText->getLocalBounds();
                 //Center text
                 solutionCountText->setOrigin(textBounds.width / 2.f, 0);
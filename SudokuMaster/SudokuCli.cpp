@@ -0,0 +1,213 @@
+/*
+Sudoku Master without the window, for servers and scripts.
+Puzzles are written as one line of 81 characters, row by row, with 0 or . for an empty cell.
+
+    sudoku-cli generate [difficulty] [count] [seed] [threads]
+                                                       difficulty is 1 (easy) to 3 (hard, the default), threads check clue removals
+                                                       at once (1 by default, 0 for one per hardware thread, at most 1024)
+                                                       without changing the puzzles
+    sudoku-cli grids [count] [seed]                    random complete grids, as fast as they can be made
+    sudoku-cli shuffle <puzzle> [count] [seed]         different looking puzzles with the same solution count and difficulty
+    sudoku-cli solve <puzzle> [max solutions]          lists the solutions, all of them unless a maximum is given
+    sudoku-cli batch <input> <output> [threads]        see BatchSolver
+
+generate, solve and batch also take --engine algorithmX|bitboard|parallel anywhere after the command, algorithmX by default.
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <ctime>
+#include <algorithm>
+#include "SudokuCore.h"
+#include "BatchSolver.h"
+#include "GridGenerator.h"
+#include "GridTransformer.h"
+#include "ThreadHelper.h"
+
+using namespace std;
+
+static void printUsage(const char* program)
+{
+	cerr << "Usage:\n"
+		<< "  " << program << " generate [difficulty 1-3] [count] [seed] [threads]\n"
+		<< "  " << program << " grids [count] [seed]\n"
+		<< "  " << program << " shuffle <puzzle> [count] [seed]\n"
+		<< "  " << program << " solve <puzzle> [max solutions]\n"
+		<< "  " << program << " batch <input> <output> [threads]\n"
+		<< "generate, solve and batch take --engine algorithmX|bitboard|parallel\n";
+}
+
+static string toLine(const vector<vector<int>>& board)
+{
+	string line;
+	for (const vector<int>& row : board) {
+		for (int num : row) {
+			line += (char)('0' + num);
+		}
+	}
+	return line;
+}
+
+//Reads the puzzle argument, saying what is wrong with it if it isn't one
+static bool parsePuzzle(int argc, char* argv[], vector<vector<int>>& puzzle)
+{
+	if (argc < 3) {
+		printUsage(argv[0]);
+		return false;
+	}
+
+	string error;
+	if (!BatchSolver::parse(argv[2], puzzle, &error)) {
+		cerr << "Not a puzzle: " << error << "\n";
+		return false;
+	}
+	return true;
+}
+
+static int generate(int argc, char* argv[], EngineType engine)
+{
+	int difficulty = argc >= 3 ? atoi(argv[2]) : 3;
+	int count = argc >= 4 ? atoi(argv[3]) : 1;
+	unsigned removalThreads = 1;
+	if (difficulty < 1 || difficulty > 3 || count < 1 || (argc >= 6 && !ThreadHelper::parseThreadCount(argv[5], removalThreads))) {
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	//The same seed always gives the same puzzles
+	srand(argc >= 5 ? (unsigned)atoi(argv[4]) : (unsigned)time(0));
+
+	SudokuCore core;
+	core.setEngine(engine);
+	core.setRemovalThreads(removalThreads);
+	for (int i = 0; i < count; i++) {
+		core.createPuzzle(difficulty);
+		cout << toLine(core.getPuzzle()) << "\n";
+	}
+
+	return 0;
+}
+
+static int grids(int argc, char* argv[])
+{
+	long long count = argc >= 3 ? atoll(argv[2]) : 1;
+	if (count < 1) {
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	GridGenerator generator(argc >= 4 ? (uint32_t)atoll(argv[3]) : (uint32_t)time(0));
+	vector<vector<int>> grid;
+	string output;
+	for (long long i = 0; i < count; i++) {
+		generator.generate(grid);
+		output += toLine(grid);
+		output += '\n';
+
+		//Write in big blocks rather than a line at a time
+		if (output.size() >= (1 << 20)) {
+			cout << output;
+			output.clear();
+		}
+	}
+	cout << output;
+
+	return 0;
+}
+
+static int shuffle(int argc, char* argv[])
+{
+	vector<vector<int>> puzzle;
+	if (!parsePuzzle(argc, argv, puzzle))
+		return 1;
+	long long count = argc >= 4 ? atoll(argv[3]) : 1;
+	if (count < 1) {
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	uint8_t cells[GridTransformer::cellCount];
+	for (int cell = 0; cell < GridTransformer::cellCount; cell++) {
+		cells[cell] = (uint8_t)puzzle[cell / 9][cell % 9];
+	}
+
+	GridTransformer transformer(argc >= 5 ? (uint32_t)atoll(argv[4]) : (uint32_t)time(0));
+	uint8_t transformed[GridTransformer::cellCount];
+	string output;
+	for (long long i = 0; i < count; i++) {
+		transformer.apply(cells, transformed);
+		transformer.next();
+		for (uint8_t num : transformed) {
+			output += (char)('0' + num);
+		}
+		output += '\n';
+
+		//Write in big blocks rather than a line at a time
+		if (output.size() >= (1 << 20)) {
+			cout << output;
+			output.clear();
+		}
+	}
+	cout << output;
+
+	return 0;
+}
+
+static int solve(int argc, char* argv[], EngineType engine)
+{
+	vector<vector<int>> puzzle;
+	if (!parsePuzzle(argc, argv, puzzle))
+		return 1;
+	long long maxSolutions = argc >= 4 ? atoll(argv[3]) : 0;
+
+	SudokuCore core;
+	core.setEngine(engine);
+	//The other engines stop at the limit themselves
+	core.solve(puzzle, false, max(maxSolutions, 0LL));
+	//Algorithm X only finds the first couple of solutions up front, ask it for more until we have enough
+	while (!core.allSolutionsFound() && (maxSolutions <= 0 || (long long)core.getSolutions().size() < maxSolutions)) {
+		if (!core.findNextSolution())
+			break;
+	}
+
+	const SolutionStore& solutions = core.getSolutions();
+	size_t shown = maxSolutions > 0 ? min(solutions.size(), (size_t)maxSolutions) : solutions.size();
+	for (size_t i = 0; i < shown; i++) {
+		cout << toLine(solutions.board(i)) << "\n";
+	}
+
+	bool more = !core.allSolutionsFound() || shown < solutions.size();
+	cerr << shown << (more ? " or more" : "") << " solution" << (shown == 1 && !more ? "" : "s") << "\n";
+
+	return 0;
+}
+
+static int batch(int argc, char* argv[], EngineType engine)
+{
+	return BatchSolver::runCommand(vector<string>(argv + 2, argv + argc), engine, string(argv[0]) + " batch <input> <output> [threads]");
+}
+
+int main(int argc, char* argv[])
+{
+	EngineType engine = EngineType::algorithmX;
+	if (!takeEngineOption(argc, argv, engine))
+		return 1;
+
+	string command = argc >= 2 ? argv[1] : "";
+
+	if (command == "generate")
+		return generate(argc, argv, engine);
+	if (command == "grids")
+		return grids(argc, argv);
+	if (command == "shuffle")
+		return shuffle(argc, argv);
+	if (command == "solve")
+		return solve(argc, argv, engine);
+	if (command == "batch")
+		return batch(argc, argv, engine);
+
+	printUsage(argv[0]);
+	return 1;
+}
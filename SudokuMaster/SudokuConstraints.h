@@ -0,0 +1,6 @@
+#pragma once
+#include "Board.h"
+
+//The usual 9x9 sudoku with 3x3 outer squares, which the game and most of the solvers are built around.
+//See Board for how placements and constraints are numbered.
+using SudokuConstraints = Board<3, 3>;
@@ -0,0 +1,510 @@
+#include "SudokuCore.h"
+#include "SudokuConstraints.h"
+#include <algorithm>
+#include <cstdlib>
+
+SudokuCore::SudokuCore()
+{
+	//Pass the progress of every solver on to whoever is listening
+	solver.progressListener = [this](const vector<vector<int>>& sudokuSolution, long long nSolutions) {
+		if (progressListener)
+			progressListener(sudokuSolution, nSolutions);
+	};
+	bitboardSolver.progressListener = solver.progressListener;
+	parallelSolver.progressListener = solver.progressListener;
+	solutionEnumerator.progressListener = solver.progressListener;
+
+	//Keep up to 256 MB of solutions (about 6.5 million) in memory, any more go to disk
+	puzzleSolutions.setMemoryLimit(256 << 20);
+
+	completeBoardData.assign(9, vector<int>(9));
+	puzzleData.assign(9, vector<int>(9));
+}
+
+void SudokuCore::createPuzzle(int difficulty)
+{
+	//Start over from an empty board
+	failedRemovalPoints.clear();
+	completeBoardData.assign(9, vector<int>(9));
+	puzzleData.assign(9, vector<int>(9));
+	allPossibilities.clearAll();
+
+	generateBoard();
+	puzzlify(difficulty);
+}
+
+void SudokuCore::setPuzzle(const vector<vector<int>>& puzzle, const vector<vector<int>>& completeBoard)
+{
+	puzzleData = puzzle;
+	completeBoardData = completeBoard;
+}
+
+bool SudokuCore::shufflePuzzle()
+{
+	if (completeBoardData[0][0] == 0)
+		return false;
+
+	//Seeded from rand like the generator, so the same srand seed still gives the same puzzles
+	gridTransformer.seed(rand());
+
+	//The puzzle and its complete board get the same transformation so they still belong together
+	vector<vector<int>> transformed;
+	gridTransformer.apply(completeBoardData, transformed);
+	completeBoardData.swap(transformed);
+	gridTransformer.apply(puzzleData, transformed);
+	puzzleData.swap(transformed);
+	return true;
+}
+
+const vector<vector<int>>& SudokuCore::getCompleteBoard() const
+{
+	return completeBoardData;
+}
+
+const vector<vector<int>>& SudokuCore::getPuzzle() const
+{
+	return puzzleData;
+}
+
+void SudokuCore::solve(const vector<vector<int>>& puzzle, bool showProgress, long long maxSolutions)
+{
+	puzzleSolutions.clear();
+	if (engine == Engine::algorithmX) {
+		algorithmX(puzzle, showProgress);
+	}
+	else {
+		//The other engines find every solution, or as many as they are allowed, before any of them can be shown
+		SolverEngine::SearchResult result = currentEngine().solve(puzzle, puzzleSolutions, maxSolutions, showProgress);
+		puzzleSolutionsComplete = !result.limitReached;
+	}
+}
+
+bool SudokuCore::findNextSolution(bool showProgress)
+{
+	if (engine != Engine::algorithmX)
+		return false;
+
+	vector<vector<int>> solution;
+	if (!solutionEnumerator.nextSolution(solution, showProgress)) {
+		puzzleSolutionsComplete = true;
+		return false;
+	}
+
+	puzzleSolutions.add(solution);
+	return true;
+}
+
+const SolutionStore& SudokuCore::getSolutions() const
+{
+	return puzzleSolutions;
+}
+
+bool SudokuCore::allSolutionsFound() const
+{
+	return puzzleSolutionsComplete;
+}
+
+void SudokuCore::clear()
+{
+	failedRemovalPoints.clear();
+	puzzleSolutions.clear();
+	puzzleSolutionsComplete = true;
+	solutionEnumerator.stopEnumeration();
+	completeBoardData.assign(9, vector<int>(9));
+	puzzleData.assign(9, vector<int>(9));
+	allPossibilities.clearAll();
+}
+
+void SudokuCore::setSolutionMemoryLimit(size_t bytes)
+{
+	puzzleSolutions.setMemoryLimit(bytes);
+}
+
+void SudokuCore::setEngine(Engine engine)
+{
+	this->engine = engine;
+}
+
+SudokuCore::Engine SudokuCore::getEngine() const
+{
+	return engine;
+}
+
+void SudokuCore::setRemovalThreads(unsigned threadCount)
+{
+	removalPool.setThreadCount(threadCount);
+}
+
+SolverEngine& SudokuCore::currentEngine()
+{
+	if (engine == Engine::bitboard)
+		return bitboardSolver;
+	if (engine == Engine::parallelAlgorithmX)
+		return parallelSolver;
+	return solver;
+}
+
+void SudokuCore::notifyGeneration(GenerationStage stage)
+{
+	if (generationListener)
+		generationListener(allPossibilities, stage);
+}
+
+void SudokuCore::generateBoard()
+{
+	//Seeded from rand so the same srand seed still gives the same puzzles
+	gridGenerator.seed(rand());
+
+	if (generationListener) {
+		//Show every number as it is placed (or taken back), along with what is still possible everywhere else.
+		//The generator always takes back the newest number first, so undoing to the mark of that placement gives back
+		//exactly the candidates it took away.
+		allPossibilities.fillAll();
+		placementMarks.clear();
+		notifyGeneration(GenerationStage::filling);
+		gridGenerator.placementListener = [this](int cell, int num) {
+			int x = cell % 9;
+			int y = cell / 9;
+			if (num != 0) {
+				placementMarks.push_back(allPossibilities.trailMark());
+				allPossibilities.clearLogged(x, y);
+				allPossibilities.eliminateFromPeersLogged(x, y, num);
+			}
+			else {
+				allPossibilities.undo(placementMarks.back());
+				placementMarks.pop_back();
+			}
+			completeBoardData[y][x] = num;
+			notifyGeneration(GenerationStage::filling);
+		};
+	}
+	else {
+		gridGenerator.placementListener = nullptr;
+	}
+
+	gridGenerator.generate(completeBoardData);
+
+	//Every cell is filled, so there is nothing left that is possible anywhere, which is where puzzlify starts from
+	allPossibilities.clearAll();
+}
+
+//Put the number back at the given x/y coordinates. Returns false if the board could not be finished with it there.
+bool SudokuCore::tryNewBoardValue(int x, int y, vector<vector<int>>& boardData, int numberToAdd)
+{
+	if (!boardStillPossible(numberToAdd, x, y, boardData)) {
+		return false;
+	}
+
+	//delete this number from the possibilities of the horizontal line, vertical line and outer square it's in, all at once.
+	allPossibilities.eliminateFromPeers(x, y, numberToAdd);
+
+	boardData[y][x] = numberToAdd;
+	return true;
+}
+
+//This is a simulation function that tries the number on allPossibilities and takes it back again afterwards,
+//if this function determines that the resulting board can still produce a viable sudoku board, then it returns true, otherwise it returns false.
+bool SudokuCore::boardStillPossible(int numberToAdd, int x, int y, vector<vector<int>>& boardData)
+{
+	size_t mark = allPossibilities.trailMark();
+	//delete this number from the possibilities of the horizontal line, vertical line and outer square it's in, remembering what changed.
+	allPossibilities.eliminateFromPeersLogged(x, y, numberToAdd);
+
+	//Logic to determine if this new board is good or not
+	//Only the positions that just lost a possibility can have run out of them. If one of them has not been written to yet
+	//(ignoring the position we are currently trying to fill) and has no possibilities left, then this is not a viable board.
+	bool possible = true;
+	const vector<CandidateGrid::TrailEntry>& trail = allPossibilities.getTrail();
+	for (size_t i = mark; i < trail.size() && possible; i++) {
+		int x1 = trail[i].cell % 9;
+		int y1 = trail[i].cell / 9;
+		if (boardData[y1][x1] == 0 && !(y1 == y && x1 == x) && allPossibilities.get(x1, y1) == 0)
+			possible = false;
+	}
+
+	//Put allPossibilities back the way it was
+	allPossibilities.undo(mark);
+	return possible;
+}
+
+void SudokuCore::puzzlify(int difficulty)
+{
+	//Fill the user's board with the entire puzzle, then incrementally remove random spots until desired difficulty level is reached.
+	puzzleData = completeBoardData;
+
+	//Most removals that fail leave some small group of cells, that could swap their numbers around, without a clue.
+	//Keeping track of those groups turns down such removals without a search.
+	unavoidableSets.build(completeBoardData);
+
+	//Every cell gets one try at being emptied, in a random order. Emptying more cells never takes solutions away,
+	//so a cell that can't be emptied now couldn't be later either and doesn't need another try.
+	removalOrder.clear();
+	for (int y = 0; y < 9; y++) {
+		for (int x = 0; x < 9; x++) {
+			removalOrder.push_back(make_pair(x, y));
+		}
+	}
+	for (int i = (int)removalOrder.size() - 1; i > 0; i--) {
+		swap(removalOrder[i], removalOrder[rand() % (i + 1)]);
+	}
+	nextRemoval = 0;
+
+	//Algorithm X can check the removals one at a time without setting the puzzle up again for every check.
+	//The next cell to try goes on top of the clues in its matrix, so it can be taken out first.
+	incrementalRemoval = engine != Engine::bitboard && removalPool.getThreadCount() == 1;
+	sunkFailures = 0;
+	if (incrementalRemoval) {
+		for (int i = (int)removalOrder.size() - 1; i >= 0; i--) {
+			int x = removalOrder[i].first;
+			int y = removalOrder[i].second;
+			removalSolver.giveClue(y, x, puzzleData[y][x]);
+		}
+	}
+
+	//First calculate for hard mode (maximum possible amount of numbers removed), then scale the puzzle to the given difficulty level
+	int maxRemovalNumbers = 0;
+	while (removeBoardValue()) {
+		maxRemovalNumbers++;
+
+		//Let the listener show the possibilities cause I want it to look cool
+		notifyGeneration(GenerationStage::removing);
+	}
+
+	//Leave removalSolver ready for the next puzzle
+	while (removalSolver.getClueCount() > 0) {
+		removalSolver.ungiveClue();
+	}
+
+	//Reset allPossibilities so that the user doesn't have all the answers
+	allPossibilities.clearAll();
+
+	notifyGeneration(GenerationStage::done);
+
+	//If hard mode, then just return with the completed puzzle
+	if (difficulty == 3) {
+		return;
+	}
+
+	//Otherwise add back random numbers until the desired difficulty is reached
+	for (int emptySpaces = maxRemovalNumbers; emptySpaces > maxRemovalNumbers * (difficulty * .25f + .25f); emptySpaces--) {
+		int x = rand() % 9;
+		int y = rand() % 9;
+
+		//Make sure the coords refer to an empty space
+		while (puzzleData[y][x] != 0) {
+			x = rand() % 9;
+			y = rand() % 9;
+		}
+
+		//Fill the space
+		puzzleData[y][x] = completeBoardData[y][x];
+	}
+
+}
+
+bool SudokuCore::checkValidValue(int val, int x, int y, vector<vector<int>>& puzzle)
+{
+	const int size = SudokuConstraints::size;
+
+	//Check row to see if one of the spots contains the given value
+	for (int col = 0; col < size; col++) {
+		if (puzzle[y][col] == val) {
+			return false;
+		}
+	}
+
+	//Check column to see if one of the spots contains the given value
+	for (int row = 0; row < size; row++) {
+		if (puzzle[row][x] == val) {
+			return false;
+		}
+	}
+
+	//Check outer square to see if one of the spots contains the given value, the cells of every outer square are worked out at compile time
+	for (int cell : SudokuConstraints::tables.boxCells[SudokuConstraints::boxOf(y, x)]) {
+		if (puzzle[cell / size][cell % size] == val) {
+			return false;
+		}
+	}
+
+	//If none of the previously checked positions contained the given value, then return true! We can use this value here!
+	return true;
+}
+
+bool SudokuCore::removeBoardValue()
+{
+	if (removalPool.getThreadCount() > 1)
+		return removeBoardValueSpeculatively();
+
+	while (nextRemoval < removalOrder.size()) {
+		int x = removalOrder[nextRemoval].first;
+		int y = removalOrder[nextRemoval].second;
+		nextRemoval++;
+
+		int value = puzzleData[y][x];
+
+		//The last clue of an unavoidable set has to stay, there is no need to ask a solver
+		if (unavoidableSets.isLastClue(x, y)) {
+			if (incrementalRemoval) {
+				liftRemovalClue();
+				removalSolver.giveClue(y, x, value);
+			}
+			failedRemovalPoints.push_back(make_pair(x, y));
+			continue;
+		}
+
+		removeBoardValue(x, y, puzzleData);
+
+		if (removalKeepsUnique(x, y, value)) {
+			unavoidableSets.removeClue(x, y);
+			return true;
+		}
+
+		//There is more than one solution now, so we have to pick a different spot
+		failedRemovalPoints.push_back(make_pair(x, y));
+		//This should never error, if it does... I would lose my faith in logic. (Or I made a stupid typo somewhere, this is also possible)
+		tryNewBoardValue(x, y, puzzleData, value);
+	}
+
+	return false;
+}
+
+bool SudokuCore::removalKeepsUnique(int x, int y, int value)
+{
+	//If there are any spots with more than 1 possibility, then we can't be sure there is only 1 solution, so we need to check them now.
+	bool checkSlns = allPossibilities.hasMultipleCandidates();
+
+	if (!incrementalRemoval) {
+		//We only need to know if there is exactly one solution, so count up to two without storing any of them
+		return !checkSlns || currentEngine().countSolutions(puzzleData, 2).solutionCount == 1;
+	}
+
+	liftRemovalClue();
+
+	//The puzzle had one solution with the clue, so any other solution now would have to put something else there
+	if (!checkSlns || !removalSolver.hasOtherSolution(y, x, value))
+		return true;
+
+	//It stays a clue for good, on top with the others that failed
+	removalSolver.giveClue(y, x, value);
+	return false;
+}
+
+void SudokuCore::liftRemovalClue()
+{
+	//nextRemoval has already moved past the cell being tried
+	size_t failedOnTop = failedRemovalPoints.size() - sunkFailures;
+	size_t untried = removalOrder.size() - (nextRemoval - 1);
+
+	if (failedOnTop < untried) {
+		//Take the clue out of removalSolver from under the ones that failed before it, which go straight back in
+		for (size_t i = 0; i < failedOnTop; i++) {
+			removalSolver.ungiveClue();
+		}
+		removalSolver.ungiveClue();
+		for (size_t i = sunkFailures; i < failedRemovalPoints.size(); i++) {
+			const pair<int, int>& point = failedRemovalPoints[i];
+			removalSolver.giveClue(point.second, point.first, puzzleData[point.second][point.first]);
+		}
+		return;
+	}
+
+	//Cheaper to sink the failed clues under the cells left to try, which leaves the one being tried on top
+	for (size_t i = 0; i < failedOnTop + untried; i++) {
+		removalSolver.ungiveClue();
+	}
+	for (size_t i = sunkFailures; i < failedRemovalPoints.size(); i++) {
+		const pair<int, int>& point = failedRemovalPoints[i];
+		removalSolver.giveClue(point.second, point.first, puzzleData[point.second][point.first]);
+	}
+	sunkFailures = failedRemovalPoints.size();
+	for (size_t i = removalOrder.size() - 1; i >= nextRemoval; i--) {
+		int x = removalOrder[i].first;
+		int y = removalOrder[i].second;
+		removalSolver.giveClue(y, x, puzzleData[y][x]);
+	}
+}
+
+bool SudokuCore::removeBoardValueSpeculatively()
+{
+	const size_t batchSize = removalPool.getThreadCount();
+
+	while (nextRemoval < removalOrder.size()) {
+		//Take the next few cells nobody knows can't be emptied, and check each of them on its own against the puzzle as it is now
+		batchPoints.clear();
+		batchOrder.clear();
+		batchPuzzles.resize(batchSize);
+		size_t i = nextRemoval;
+		for (; i < removalOrder.size() && batchPoints.size() < batchSize; i++) {
+			pair<int, int> point = removalOrder[i];
+			if (find(failedRemovalPoints.begin(), failedRemovalPoints.end(), point) != failedRemovalPoints.end())
+				continue;
+			//The last clue of an unavoidable set has to stay, there is no need to check it
+			if (unavoidableSets.isLastClue(point.first, point.second)) {
+				failedRemovalPoints.push_back(point);
+				continue;
+			}
+
+			batchPuzzles[batchPoints.size()] = puzzleData;
+			batchPuzzles[batchPoints.size()][point.second][point.first] = 0;
+			batchPoints.push_back(point);
+			batchOrder.push_back(i);
+		}
+		batchPuzzles.resize(batchPoints.size());
+		nextRemoval = i;
+
+		removalPool.check(batchPuzzles, batchUnique, engine == Engine::bitboard);
+
+		//Take the first one in order that stays unique, just like trying them one at a time would.
+		//The ones that didn't stay unique never will, including those after it, so they don't need checking again.
+		//The ones after it that did were checked with a clue too many and have to be checked again.
+		size_t taken = batchPoints.size();
+		for (size_t j = 0; j < batchPoints.size(); j++) {
+			if (!batchUnique[j])
+				failedRemovalPoints.push_back(batchPoints[j]);
+			else if (taken == batchPoints.size())
+				taken = j;
+		}
+
+		if (taken < batchPoints.size()) {
+			removeBoardValue(batchPoints[taken].first, batchPoints[taken].second, puzzleData);
+			unavoidableSets.removeClue(batchPoints[taken].first, batchPoints[taken].second);
+			nextRemoval = batchOrder[taken] + 1;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void SudokuCore::removeBoardValue(int x, int y, vector<vector<int>>& puzzle)
+{
+	int value = puzzle[y][x];
+	//Remove the value from the given position
+	puzzle[y][x] = 0;
+	//Add possibilities to all spaces in the same row, column and outer square
+	const CandidateGrid::CellSet& peers = CandidateGrid::peerTable.peers[y * 9 + x];
+	for (int row = 0; row < 9; row++) {
+		for (int col = 0; col < 9; col++) {
+			//If this position isn't in the same row, column or outer square or already has this value as a possibility, skip it
+			if (peers.lanes[row * 9 + col] == 0 || allPossibilities.has(col, row, value))
+				continue;
+			//Check if the position we are about to write to is actually able to take this new value as an option
+			if (checkValidValue(value, col, row, puzzle))
+				allPossibilities.add(col, row, value);
+		}
+	}
+}
+
+void SudokuCore::algorithmX(const vector<vector<int>>& puzzle, bool showProgress)
+{
+	//The solver keeps the exact cover matrix of every placement around between calls.
+	//It takes care of ruling out the placements that clash with the givens, so we don't need allPossibilities here.
+	solutionEnumerator.startEnumeration(puzzle);
+	puzzleSolutionsComplete = false;
+
+	//Find the first solution to show, and a second one so we know whether the puzzle has more than one.
+	//The rest are only looked for when they are asked for.
+	if (findNextSolution(showProgress))
+		findNextSolution(showProgress);
+}
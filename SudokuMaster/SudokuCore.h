@@ -0,0 +1,190 @@
+#pragma once
+#include <vector>
+#include <functional>
+#include <utility>
+#include "SudokuSolver.h"
+#include "BitboardSolver.h"
+#include "ParallelSolver.h"
+#include "CandidateGrid.h"
+#include "SolutionStore.h"
+#include "GridGenerator.h"
+#include "GridTransformer.h"
+#include "UniquenessPool.h"
+#include "UnavoidableSets.h"
+
+using namespace std;
+
+//Everything Sudoku Master does besides drawing it: generating complete boards, turning them into puzzles and solving puzzles.
+//Nothing in here depends on SFML or Windows, so the window and the command line tool are both just clients of it.
+//Listeners report what it is doing so a client can show it as it goes, it never waits for anyone itself.
+class SudokuCore
+{
+public:
+	SudokuCore();
+
+	//The engines that can solve puzzles and check that generated puzzles are unique, see EngineType
+	using Engine = EngineType;
+
+	//What generation was doing when it reports the candidates:
+	//filling - a number was placed on the complete board, removing - a number was taken out of the puzzle, done - the puzzle is ready
+	enum class GenerationStage { filling, removing, done };
+
+	//Called every time generation changes the candidates of the board.
+	//Without a listener the complete board is made in one go, with one every number placed on it is reported so it can be animated.
+	function<void(const CandidateGrid& candidates, GenerationStage stage)> generationListener;
+
+	//Called with the partial solution the solver is working on and the number of solutions found so far, when solving with showProgress
+	function<void(const vector<vector<int>>& partialSolution, long long nSolutions)> progressListener;
+
+	//Generates a new complete board and makes a puzzle with exactly one solution out of it.
+	//Difficulty 3 removes as many numbers as possible, lower difficulties put some of them back.
+	void createPuzzle(int difficulty);
+
+	//Takes a puzzle made earlier, like a saved one, and its complete board as the last puzzle created
+	void setPuzzle(const vector<vector<int>>& puzzle, const vector<vector<int>>& completeBoard);
+
+	//Makes a new puzzle out of the last one created by relabelling its numbers and shuffling its rows, columns, bands and stacks.
+	//It still has exactly one solution and is just as hard, but costs next to nothing compared to createPuzzle.
+	//Returns false and leaves everything as it is if there is no puzzle yet.
+	bool shufflePuzzle();
+
+	//The complete board of the last puzzle created
+	const vector<vector<int>>& getCompleteBoard() const;
+
+	//The last puzzle created, 0 for an empty cell
+	const vector<vector<int>>& getPuzzle() const;
+
+	//Starts solving the puzzle. With algorithmX the first two solutions are found (enough to tell if the puzzle is unique),
+	//the other engines find them all, or stop after maxSolutions of them if it isn't 0.
+	void solve(const vector<vector<int>>& puzzle, bool showProgress = true, long long maxSolutions = 0);
+
+	//Finds one more solution of the puzzle being solved. Returns false if there are no more.
+	//Only algorithmX can pick up where it stopped, with the other engines this returns false and the solutions stay as they are.
+	bool findNextSolution(bool showProgress = false);
+
+	//The solutions of the puzzle being solved, as far as they have been found
+	const SolutionStore& getSolutions() const;
+
+	//Returns true if every solution of the puzzle has been found, otherwise getSolutions is only part of them
+	bool allSolutionsFound() const;
+
+	//Drops the puzzle and its solutions
+	void clear();
+
+	//Sets how many bytes of solutions are kept in memory before the rest go to a temporary file on disk
+	void setSolutionMemoryLimit(size_t bytes);
+
+	//Chooses the engine used from now on by solve and puzzle generation
+	void setEngine(Engine engine);
+
+	Engine getEngine() const;
+
+	//Sets how many clue removals createPuzzle checks at once while making a puzzle, 0 uses one per hardware thread.
+	//With more than one, the next few cells to empty are each checked on their own thread and the first of them that keeps
+	//the puzzle unique is taken, so the puzzles made for a seed are the same whatever the thread count.
+	void setRemovalThreads(unsigned threadCount);
+
+private:
+	//A grid containing all possible values for every position on the board as bitmasks. This will be updated as the board is generated.
+	CandidateGrid allPossibilities;
+
+	//A list of solutions possible for the given puzzle in the solve portion, as far as they have been found.
+	//Huge lists of solutions go to disk rather than running out of memory.
+	SolutionStore puzzleSolutions;
+
+	//True once puzzleSolutions holds every solution of the puzzle
+	bool puzzleSolutionsComplete = true;
+
+	vector<vector<int>> completeBoardData;
+
+	vector<vector<int>> puzzleData;
+
+	//Keeps the exact cover matrix between calls so it is only built once
+	SudokuSolver solver;
+
+	//Splits the search over every core when listing all the solutions of a puzzle
+	ParallelSolver parallelSolver;
+
+	//Lists the solutions of the puzzle being solved one at a time. It is separate from solver so that generating a puzzle doesn't drop its place.
+	SudokuSolver solutionEnumerator;
+
+	BitboardSolver bitboardSolver;
+
+	Engine engine = Engine::algorithmX;
+
+	//Makes the complete boards
+	GridGenerator gridGenerator;
+
+	//Makes new looking puzzles out of the last one
+	GridTransformer gridTransformer;
+
+	//Where the trail of allPossibilities was before each number of the grid being generated was placed, only kept while it is watched
+	vector<size_t> placementMarks;
+
+	//The cells (x, y) puzzlify already tried to empty without keeping the solution unique
+	vector<pair<int, int>> failedRemovalPoints;
+
+	//Every cell (x, y) in the random order puzzlify tries to empty them in, and how far along it is
+	vector<pair<int, int>> removalOrder;
+	size_t nextRemoval = 0;
+
+	//The unavoidable sets of the complete board, which say which clues of the puzzle can't be removed without searching
+	UnavoidableSets unavoidableSets;
+
+	//Checks the speculative removals when there is more than one removal thread
+	UniquenessPool removalPool;
+
+	//Checks the removals one at a time with Algorithm X when there is only one removal thread. Every clue of the puzzle stays
+	//given in its matrix while puzzlify runs: the first sunkFailures of failedRemovalPoints at the bottom, then the cells still
+	//to try in reverse removalOrder, then the rest of failedRemovalPoints on top.
+	SudokuSolver removalSolver;
+	bool incrementalRemoval = false;
+	size_t sunkFailures = 0;
+
+	//The cells of the batch of removals being checked, their place in removalOrder, the puzzles without them and which stayed unique
+	vector<pair<int, int>> batchPoints;
+	vector<size_t> batchOrder;
+	vector<vector<vector<int>>> batchPuzzles;
+	vector<char> batchUnique;
+
+	//Returns the solver of the chosen engine
+	SolverEngine& currentEngine();
+
+	void notifyGeneration(GenerationStage stage);
+
+	void generateBoard();
+
+	//Puts a number back in the puzzle. Returns false if the board would be left without a way to finish it.
+	bool tryNewBoardValue(int x, int y, vector<vector<int>>& boardData, int numberToAdd);
+
+	bool boardStillPossible(int numberToAdd, int x, int y, vector<vector<int>>& boardData);
+
+	//After generating a board, make it into a puzzle
+	void puzzlify(int difficulty);
+
+	//Checks if the row, column, and outer square does not contain the given value (thus making it possible to place the value here)
+	bool checkValidValue(int val, int x, int y, vector<vector<int>>& puzzle);
+
+	//Remove the value at the next position of removalOrder that can be emptied while keeping the puzzle unique
+	//Returns true if successful, false if no more points can be removed.
+	bool removeBoardValue();
+
+	//Same as removeBoardValue, but checks the next few positions at once on removalPool
+	bool removeBoardValueSpeculatively();
+
+	//Returns true if the puzzle still has exactly one solution now that value has been taken out of (x, y)
+	bool removalKeepsUnique(int x, int y, int value);
+
+	//Takes the clue of the cell being tried out of removalSolver, from under the clues that failed since the last sink.
+	//Those have to come off and go back on, so once there are as many of them as cells left to try, they are sunk under
+	//the cells left to try instead, so there are never more of them on top than cells left to try.
+	void liftRemovalClue();
+
+	//Remove a value at a specific position
+	void removeBoardValue(int x, int y, vector<vector<int>>& puzzle);
+
+	//Given a sudoku puzzle, algorithm X will start listing its solutions and add the first two to puzzleSolutions
+	//I did not come up with this on my own, which is why this method is named after the algorithm I am using.
+	//I learned the concept from wikipedia and impemented it in my program. The same goes for the DoubleLinkedNodes. 
+	void algorithmX(const vector<vector<int>>& puzzle, bool showProgress);
+};
@@ -3,10 +3,11 @@
 #include <mutex>
 #include <fstream>
 #include "SudokuNumberButton.h"
-#include "DoubleLinkedNodeMatrix.h"
+#include "SudokuCore.h"
 
 using namespace std;
 
+//The sudoku board of the window. Generating and solving is all done by SudokuCore, this shows it on the board buttons and handles the player's input.
 class SudokuMaster
 {
 public:
@@ -29,6 +30,10 @@ public:
 	//Create Sudoku puzzle from start to finish
 	void createSudokuPuzzle(int difficulty);
 
+	//Shuffles the last puzzle created or loaded into a new one that is just as hard, without generating a new one.
+	//Returns false and leaves the board alone if there is no puzzle to shuffle.
+	bool shuffleSudokuPuzzle();
+
 	//Update the labels on all the buttons
 	void updateBoardLabels();
 
@@ -57,25 +62,37 @@ public:
 	//Solves the puzzle stored in userBoardData
 	void solvePuzzle();
 
-	//Returns the number of solutions found
+	//Returns the number of solutions found so far
 	int solutionsFound();
 
-	//Displays the next solution found for the puzzle
+	//Returns true if every solution of the puzzle has been found, otherwise solutionsFound is only a lower bound
+	bool allSolutionsFound();
+
+	//Displays the next solution found for the puzzle, looking for it first if it hasn't been found yet,
 	//or the previous solution if forward is false
 	void rotateSolution(bool forward);
 
 	int getSolutionIndex();
 
+	//Sets how many bytes of solutions are kept in memory before the rest go to a temporary file on disk
+	void setSolutionMemoryLimit(size_t bytes);
+
+	//The engines that can solve puzzles and check that generated puzzles are unique.
+	//With algorithmX the solutions are found one at a time as they are viewed, the others find every solution up front.
+	using Engine = SudokuCore::Engine;
+
+	//Chooses the engine used from now on by solvePuzzle and puzzle generation
+	void setEngine(Engine engine);
+
+	Engine getEngine();
+
 private:
 	int solutionIndex = 0;
 
 	vector<vector<shared_ptr<SudokuNumberButton>>> boardButtons;
 
-	//A three dimensional vector containing all possible values for every position on the board. This will be updated as the board is generated.
-	vector<vector<vector<int>>> allPossibilities;
-
-	//A list of solutions possible for the given puzzle in the solve portion.
-	vector<vector<vector<int>>> puzzleSolutions;
+	//Generates the puzzles and solves them
+	SudokuCore core;
 
 	vector<vector<int>> completeBoardData;
 
@@ -89,49 +106,14 @@ private:
 
 	float x, y;
 
-	vector<shared_ptr<DoubleLinkedNode>> partialSolutionRows;
-
-	void updateButtonNotes();
-
-	void generateBoard();
-
-	bool tryNewBoardValue(int x, int y, vector<vector<int>>& boardData, int numberToAdd = 0);
-
-	bool boardStillPossible(int numberToAdd, int x, int y, vector<vector<int>>& boardData);
-
-	string convertBase(int n, int base);
-
-	//After generating a board, make it into a puzzle
-	void puzzlify(int difficulty);
-
-	vector<sf::Vector2i> failedRemovalPoints;
-
-	//Checks if the row, column, and outer square does not contain the given value (thus making it possible to place the value here)
-	bool checkValidValue(int val, int x, int y, vector<vector<int>>& puzzle);
-
-	//Remove a value at a random position
-	//Returns true if successful, false if no more points can be removed.
-	bool removeBoardValue();
-
-	//Remove a value at a specific position
-	void removeBoardValue(int x, int y, vector<vector<int>>& puzzle);
-
-	//Given a sudoku puzzle, algorithm X will return a list of possible solutions or an empty vector
-	//I did not come up with this on my own, which is why this method is named after the algorithm I am using.
-	//I learned the concept from wikipedia and impemented it in my program. The same goes for the DoubleLinkedNodes. 
-	vector<vector<vector<int>>> algorithmX(vector<vector<int>>& puzzle, bool solving);
-
-	//Returns a board of values containing the current progress of the program in solving the puzzle
-	void updateSolutionProgress(int nSolutions);
-
-	//The function that solves the exact cover of the sudoku puzzle
-	void searchExactCover(DoubleLinkedNodeMatrix& matrix, vector<vector<shared_ptr<DoubleLinkedNode>>>& solutions, bool solving);
+	//Puts the puzzle the core just made on the board and saves it to puzzle.txt
+	void showNewPuzzle();
 
-	//Cover the column/rows of the given node in the given matrix
-	void cover(shared_ptr<DoubleLinkedNode> node);
+	//Shows the candidates as notes on the board buttons
+	void updateButtonNotes(const CandidateGrid& candidates);
 
-	//Uncover the column/rows of the given node in the given matrix
-	void uncover(shared_ptr<DoubleLinkedNode> node);
+	//Displays the partial solution the solver is currently working on
+	void updateSolutionProgress(const vector<vector<int>>& sudokuSolution, long long nSolutions);
 
 
 	//void printBoard(const vector<vector<int>>* const board, int size = 9);
@@ -0,0 +1,163 @@
+#include "SudokuSolver.h"
+
+template <class Geometry>
+BasicSudokuSolver<Geometry>::BasicSudokuSolver(const BasicConstraintModel<Geometry>& model) :
+	exactCover(model.getConstraintCount(), model.placementRows()),
+	propagator(model)
+{
+}
+
+template <class Geometry>
+typename BasicSudokuSolver<Geometry>::SearchResult BasicSudokuSolver<Geometry>::solve(const vector<vector<int>>& puzzle, BasicSolutionStore<Geometry>& solutions, long long maxSolutions, bool showProgress)
+{
+	return search(puzzle, &solutions, maxSolutions, showProgress);
+}
+
+template <class Geometry>
+typename BasicSudokuSolver<Geometry>::SearchResult BasicSudokuSolver<Geometry>::countSolutions(const vector<vector<int>>& puzzle, long long maxSolutions)
+{
+	return search(puzzle, nullptr, maxSolutions, false);
+}
+
+template <class Geometry>
+typename BasicSudokuSolver<Geometry>::SearchResult BasicSudokuSolver<Geometry>::search(const vector<vector<int>>& puzzle, BasicSolutionStore<Geometry>* solutions, long long maxSolutions, bool showProgress)
+{
+	SearchResult result{ 0, false };
+
+	startEnumeration(puzzle);
+
+	while (searchExactCover(showProgress)) {
+		//When we are only counting, the solution is simply thrown away
+		if (solutions)
+			solutions->add(toBoard(exactCover.getSolution()));
+		result.solutionCount++;
+
+		//We have all the solutions we were asked for, so stop here
+		if (maxSolutions > 0 && result.solutionCount >= maxSolutions) {
+			result.limitReached = true;
+			break;
+		}
+	}
+
+	//Restore the matrix for the next puzzle
+	stopEnumeration();
+
+	return result;
+}
+
+template <class Geometry>
+void BasicSudokuSolver<Geometry>::startEnumeration(const vector<vector<int>>& puzzle)
+{
+	//Fill in every cell forced by singles first, they are part of every solution anyway.
+	//A contradiction here means the puzzle has no solutions, so the matrix isn't touched at all.
+	vector<vector<int>> reduced = puzzle;
+	if (!propagator.propagate(reduced)) {
+		exactCover.stop();
+		return;
+	}
+
+	//Select the row of every filled cell so the search only has to deal with the empty cells
+	vector<int> givenRows;
+	for (int row = 0; row < Geometry::size; row++) {
+		for (int col = 0; col < Geometry::size; col++) {
+			if (reduced[row][col] != 0)
+				givenRows.push_back(Geometry::placementOf(row, col, reduced[row][col]));
+		}
+	}
+
+	//If a given clashes with an earlier given, the puzzle has no solutions and the search is over before it started
+	exactCover.start(givenRows);
+}
+
+template <class Geometry>
+bool BasicSudokuSolver<Geometry>::nextSolution(vector<vector<int>>& solution, bool showProgress)
+{
+	if (!searchExactCover(showProgress))
+		return false;
+
+	solution = toBoard(exactCover.getSolution());
+	return true;
+}
+
+template <class Geometry>
+void BasicSudokuSolver<Geometry>::stopEnumeration()
+{
+	exactCover.stop();
+}
+
+template <class Geometry>
+bool BasicSudokuSolver<Geometry>::giveClue(int row, int col, int num)
+{
+	return exactCover.fixRow(Geometry::placementOf(row, col, num));
+}
+
+template <class Geometry>
+void BasicSudokuSolver<Geometry>::ungiveClue()
+{
+	exactCover.unfixRow();
+}
+
+template <class Geometry>
+int BasicSudokuSolver<Geometry>::getClueCount() const
+{
+	return (int)exactCover.getFixedRows().size();
+}
+
+template <class Geometry>
+bool BasicSudokuSolver<Geometry>::hasOtherSolution(int row, int col, int num)
+{
+	for (int other = 1; other <= Geometry::size; other++) {
+		if (other == num)
+			continue;
+
+		//The other number has to fit with the clues before it's worth searching
+		bool found = exactCover.start({ Geometry::placementOf(row, col, other) }) && exactCover.next();
+		exactCover.stop();
+		if (found)
+			return true;
+	}
+
+	return false;
+}
+
+template <class Geometry>
+vector<vector<int>> BasicSudokuSolver<Geometry>::toBoard(const vector<int>& placements)
+{
+	const int size = Geometry::size;
+	const int sizeSquared = Geometry::cellCount;
+
+	//Create a temp puzzle to hold the solution and initialize it to the size of the puzzle
+	vector<vector<int>> board(size, vector<int>(size));
+
+	//Add solution parts to appropriate position with the correct number
+	for (int placement : placements) {
+		int row = placement / sizeSquared;
+		int col = (placement % sizeSquared) / size;
+		int num = (placement % sizeSquared) % size + 1;
+		board[row][col] = num;
+	}
+
+	return board;
+}
+
+template <class Geometry>
+bool BasicSudokuSolver<Geometry>::searchExactCover(bool showProgress)
+{
+	//Update graphical component if we are solving
+	if (showProgress && this->progressListener) {
+		exactCover.progressListener = [this](const vector<int>& rows) {
+			this->progressListener(toBoard(rows), exactCover.getSolutionCount());
+		};
+	}
+
+	bool found = exactCover.next();
+	exactCover.progressListener = nullptr;
+	return found;
+}
+
+//The board sizes the solver is built for
+template class BasicSudokuSolver<Board<2, 2>>;
+template class BasicSudokuSolver<Board<2, 3>>;
+template class BasicSudokuSolver<Board<3, 3>>;
+template class BasicSudokuSolver<Board<4, 4>>;
+template class BasicSudokuSolver<Board<5, 5>>;
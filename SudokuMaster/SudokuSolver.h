@@ -0,0 +1,70 @@
+#pragma once
+#include <vector>
+#include "ExactCover/ExactCoverSolver.h"
+#include "SolverEngine.h"
+#include "SinglesPropagator.h"
+#include "ConstraintModel.h"
+
+using namespace std;
+
+//Holds the complete exact cover matrix of a sudoku of the given Board size so it only has to be built once.
+//The matrix comes from a ConstraintModel, so variants with extra units are solved the same way as the classic puzzle.
+//Every query first fills in the cells forced by singles, selects the rows of what is filled in, searches what is left,
+//and then restores the matrix for the next query.
+template <class Geometry>
+class BasicSudokuSolver : public BasicSolverEngine<Geometry>
+{
+public:
+	using typename BasicSolverEngine<Geometry>::SearchResult;
+
+	//Solves the puzzles of the model, the classic one unless told otherwise
+	BasicSudokuSolver(const BasicConstraintModel<Geometry>& model = BasicConstraintModel<Geometry>());
+
+	SearchResult solve(const vector<vector<int>>& puzzle, BasicSolutionStore<Geometry>& solutions, long long maxSolutions = 0, bool showProgress = false) override;
+
+	SearchResult countSolutions(const vector<vector<int>>& puzzle, long long maxSolutions = 0) override;
+
+	//Starts listing the solutions of the puzzle one at a time, each call to nextSolution resumes the search where it stopped.
+	//Only one puzzle can be listed at a time, starting a new one or calling solve/countSolutions drops the one in progress.
+	void startEnumeration(const vector<vector<int>>& puzzle);
+
+	//Finds the next solution of the puzzle given to startEnumeration. Returns false once there are no more.
+	bool nextSolution(vector<vector<int>>& solution, bool showProgress = false);
+
+	//Drops the enumeration in progress and restores the matrix
+	void stopEnumeration();
+
+	//Clues that stay selected in the matrix between queries, so a puzzle that only changes by one clue at a time
+	//doesn't have to be set up again for every check. Only the last clue given can be taken back out, and every other
+	//query is answered on top of them, so take them all out again before using the solver for anything else.
+	//Returns false if the clue clashes with the ones already given, in which case it isn't given.
+	bool giveClue(int row, int col, int num);
+
+	//Takes the last clue given back out
+	void ungiveClue();
+
+	int getClueCount() const;
+
+	//Returns true if the clues can be completed with the cell (which must not be one of the clues) holding anything but num.
+	//If the clues plus num in the cell have exactly one solution, this tells whether the clues alone still do:
+	//any other solution would have to differ from it in that cell. Only searches until it finds one.
+	bool hasOtherSolution(int row, int col, int num);
+
+private:
+	//The search itself, the rows of the matrix are the placements in the order of Geometry::placementOf
+	ExactCoverSolver exactCover;
+
+	//Fills in the forced cells before the search starts
+	BasicSinglesPropagator<Geometry> propagator;
+
+	//Translates a list of placements into the board it describes
+	static vector<vector<int>> toBoard(const vector<int>& placements);
+
+	//Enumerates the solutions of the puzzle, storing them only if solutions is not null, and restores the matrix afterwards
+	SearchResult search(const vector<vector<int>>& puzzle, BasicSolutionStore<Geometry>* solutions, long long maxSolutions, bool showProgress);
+
+	//Runs the search until the next solution and returns true with the solution in exactCover, or false if there are no more
+	bool searchExactCover(bool showProgress);
+};
+
+using SudokuSolver = BasicSudokuSolver<SudokuConstraints>;
@@ -0,0 +1,44 @@
+#include "ThreadHelper.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+unsigned ThreadHelper::resolveThreadCount(unsigned threadCount)
+{
+	if (threadCount == 0)
+		threadCount = thread::hardware_concurrency();
+	//hardware_concurrency is allowed to return 0 if it can't tell
+	return max(threadCount, 1u);
+}
+
+bool ThreadHelper::parseThreadCount(const string& text, unsigned& threadCount)
+{
+	//strtoul would skip leading spaces and quietly wrap a minus sign around, so only digits are let through to it
+	if (text.empty() || text.find_first_not_of("0123456789") != string::npos)
+		return false;
+
+	errno = 0;
+	unsigned long value = strtoul(text.c_str(), nullptr, 10);
+	if (errno == ERANGE || value > maxThreadCount)
+		return false;
+
+	threadCount = (unsigned)value;
+	return true;
+}
+
+void ThreadHelper::runOnThreads(size_t threadCount, const function<void(size_t index)>& work)
+{
+	if (threadCount == 0)
+		return;
+
+	vector<thread> threads;
+	for (size_t i = 1; i < threadCount; i++) {
+		threads.emplace_back(work, i);
+	}
+	work(0);
+	for (thread& t : threads) {
+		t.join();
+	}
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <string>
+
+using namespace std;
+
+//The thread handling shared by everything that splits its work over a number of threads
+class ThreadHelper
+{
+public:
+	//Turns a requested thread count into the one to use: 0 means one thread per hardware thread, and it is never less than 1
+	static unsigned resolveThreadCount(unsigned threadCount);
+
+	//The most threads a thread count given on the command line may ask for
+	static constexpr unsigned maxThreadCount = 1024;
+
+	//Reads a thread count given as text, 0 meaning one per hardware thread. Returns false if the whole text isn't
+	//a number from 0 to maxThreadCount, so a typo or a negative number can't turn into some other count.
+	static bool parseThreadCount(const string& text, unsigned& threadCount);
+
+	//Calls work with every index from 0 to threadCount - 1, each on its own thread, and returns once they are all done.
+	//Index 0 runs on the calling thread so it does its share instead of just waiting.
+	static void runOnThreads(size_t threadCount, const function<void(size_t index)>& work);
+};
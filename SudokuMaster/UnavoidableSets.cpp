@@ -0,0 +1,80 @@
+#include "UnavoidableSets.h"
+#include <numeric>
+#include <algorithm>
+
+void UnavoidableSets::build(const vector<vector<int>>& grid)
+{
+	remainingClues.clear();
+	for (vector<int>& list : cellSets) {
+		list.clear();
+	}
+
+	//Where every number is in every row, column and outer square
+	int rowCell[size][size + 1];
+	int colCell[size][size + 1];
+	int boxCell[size][size + 1];
+	for (int row = 0; row < size; row++) {
+		for (int col = 0; col < size; col++) {
+			int num = grid[row][col];
+			int cell = row * size + col;
+			rowCell[row][num] = cell;
+			colCell[col][num] = cell;
+			boxCell[SudokuConstraints::boxOf(row, col)][num] = cell;
+		}
+	}
+
+	//Which group every cell is in, as a union-find forest over the cells
+	int parent[cellCount];
+	auto findRoot = [&](int cell) {
+		while (parent[cell] != cell) {
+			parent[cell] = parent[parent[cell]];
+			cell = parent[cell];
+		}
+		return cell;
+	};
+
+	for (int a = 1; a <= size; a++) {
+		for (int b = a + 1; b <= size; b++) {
+			iota(parent, parent + cellCount, 0);
+
+			//Swapping a and b in a cell means the cell with the other one in the same row, column and outer square has to swap too
+			for (int i = 0; i < size; i++) {
+				parent[findRoot(rowCell[i][a])] = findRoot(rowCell[i][b]);
+				parent[findRoot(colCell[i][a])] = findRoot(colCell[i][b]);
+				parent[findRoot(boxCell[i][a])] = findRoot(boxCell[i][b]);
+			}
+
+			//Every group is a set. A single group of all 18 cells is one too, a puzzle without either number can always swap them.
+			int groupSet[cellCount];
+			fill(groupSet, groupSet + cellCount, -1);
+			for (int num : { a, b }) {
+				for (int row = 0; row < size; row++) {
+					int cell = rowCell[row][num];
+					int root = findRoot(cell);
+					if (groupSet[root] < 0) {
+						groupSet[root] = (int)remainingClues.size();
+						remainingClues.push_back(0);
+					}
+					remainingClues[groupSet[root]]++;
+					cellSets[cell].push_back(groupSet[root]);
+				}
+			}
+		}
+	}
+}
+
+bool UnavoidableSets::isLastClue(int x, int y) const
+{
+	for (int set : cellSets[y * size + x]) {
+		if (remainingClues[set] == 1)
+			return true;
+	}
+	return false;
+}
+
+void UnavoidableSets::removeClue(int x, int y)
+{
+	for (int set : cellSets[y * size + x]) {
+		remainingClues[set]--;
+	}
+}
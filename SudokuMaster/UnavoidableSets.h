@@ -0,0 +1,33 @@
+#pragma once
+#include <vector>
+#include "SudokuConstraints.h"
+
+using namespace std;
+
+//Sets of cells of a complete 9x9 grid that a puzzle made from it needs at least one clue in, because the numbers in them can be
+//moved around without breaking any rule. The ones found here each swap two numbers: for every pair of numbers, the cells holding
+//either of them split into groups that can swap the two numbers on their own (the smallest are the four cells of a deadly rectangle).
+//Every set keeps count of its cells that are still clues, so removing a clue can be turned down without searching when it is
+//the last one of a set. A removal the sets don't rule out still has to be checked by a solver, since they aren't every unavoidable set.
+class UnavoidableSets
+{
+public:
+	//Finds the sets of the complete grid, with every cell a clue to start with
+	void build(const vector<vector<int>>& grid);
+
+	//Returns true if the cell is the last clue of one of the sets, so the puzzle would have more than one solution without it
+	bool isLastClue(int x, int y) const;
+
+	//Takes the cell out of the clues of every set it is in
+	void removeClue(int x, int y);
+
+private:
+	static constexpr int size = SudokuConstraints::size;
+	static constexpr int cellCount = SudokuConstraints::cellCount;
+
+	//How many cells of every set are still clues
+	vector<int> remainingClues;
+
+	//The sets every cell (row * 9 + col) is in
+	vector<int> cellSets[cellCount];
+};
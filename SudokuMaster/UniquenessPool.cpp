@@ -0,0 +1,100 @@
+#include "UniquenessPool.h"
+#include "ThreadHelper.h"
+#include <algorithm>
+
+UniquenessPool::UniquenessPool(unsigned threadCount) :
+	nextPuzzle(0)
+{
+	setThreadCount(threadCount);
+}
+
+UniquenessPool::~UniquenessPool()
+{
+	stopThreads();
+}
+
+void UniquenessPool::setThreadCount(unsigned threadCount)
+{
+	threadCount = ThreadHelper::resolveThreadCount(threadCount);
+	if (threadCount == getThreadCount())
+		return;
+
+	stopThreads();
+
+	workers.clear();
+	for (unsigned i = 0; i < threadCount; i++) {
+		workers.push_back(make_unique<Worker>());
+	}
+	for (unsigned i = 1; i < threadCount; i++) {
+		threads.emplace_back(&UniquenessPool::threadLoop, this, ref(*workers[i]), batchNumber);
+	}
+}
+
+unsigned UniquenessPool::getThreadCount() const
+{
+	return (unsigned)workers.size();
+}
+
+void UniquenessPool::check(const vector<vector<vector<int>>>& puzzles, vector<char>& unique, bool useBitboard)
+{
+	unique.assign(puzzles.size(), 0);
+
+	{
+		lock_guard<mutex> lock(poolMutex);
+		this->puzzles = &puzzles;
+		this->unique = &unique;
+		this->useBitboard = useBitboard;
+		nextPuzzle = 0;
+		busyThreads = threads.size();
+		batchNumber++;
+	}
+	batchReady.notify_all();
+
+	work(*workers[0]);
+
+	unique_lock<mutex> lock(poolMutex);
+	batchDone.wait(lock, [this] { return busyThreads == 0; });
+	this->puzzles = nullptr;
+	this->unique = nullptr;
+}
+
+void UniquenessPool::threadLoop(Worker& worker, long long lastBatch)
+{
+	unique_lock<mutex> lock(poolMutex);
+	while (true) {
+		batchReady.wait(lock, [&] { return stopping || batchNumber != lastBatch; });
+		if (stopping)
+			return;
+		lastBatch = batchNumber;
+
+		lock.unlock();
+		work(worker);
+		lock.lock();
+
+		if (--busyThreads == 0)
+			batchDone.notify_one();
+	}
+}
+
+void UniquenessPool::work(Worker& worker)
+{
+	SolverEngine& engine = useBitboard ? (SolverEngine&)worker.bitboardSolver : (SolverEngine&)worker.solver;
+	for (size_t i = nextPuzzle++; i < puzzles->size(); i = nextPuzzle++) {
+		//Two solutions are enough to tell a unique puzzle from one that isn't
+		(*unique)[i] = engine.countSolutions((*puzzles)[i], 2).solutionCount == 1;
+	}
+}
+
+void UniquenessPool::stopThreads()
+{
+	{
+		lock_guard<mutex> lock(poolMutex);
+		stopping = true;
+	}
+	batchReady.notify_all();
+	for (thread& t : threads) {
+		t.join();
+	}
+	threads.clear();
+	stopping = false;
+}
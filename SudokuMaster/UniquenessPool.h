@@ -0,0 +1,74 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include "SudokuSolver.h"
+#include "BitboardSolver.h"
+
+using namespace std;
+
+//Checks whether puzzles have exactly one solution, spread over worker threads that stay around between calls.
+//Puzzle generation hands out a few quick checks at a time, which would be over before new threads had even started.
+//The thread calling check does its share too, so a pool of one thread runs everything on the caller.
+class UniquenessPool
+{
+public:
+	//A thread count of 0 uses one thread per hardware thread
+	UniquenessPool(unsigned threadCount = 1);
+
+	~UniquenessPool();
+
+	UniquenessPool(const UniquenessPool&) = delete;
+	UniquenessPool& operator=(const UniquenessPool&) = delete;
+
+	void setThreadCount(unsigned threadCount);
+
+	unsigned getThreadCount() const;
+
+	//Sets unique[i] to 1 if puzzles[i] has exactly one solution, otherwise 0. Returns once every puzzle is checked.
+	//The checks are done with the bitboard solver if useBitboard is set, otherwise with Algorithm X.
+	void check(const vector<vector<vector<int>>>& puzzles, vector<char>& unique, bool useBitboard);
+
+private:
+	//Every thread needs its own solvers, they keep state between calls
+	struct Worker
+	{
+		SudokuSolver solver;
+		BitboardSolver bitboardSolver;
+	};
+
+	//workers[0] belongs to the calling thread, the rest each to one of threads
+	vector<unique_ptr<Worker>> workers;
+	vector<thread> threads;
+
+	mutex poolMutex;
+	//Wakes the threads when there is a new batch or they have to stop
+	condition_variable batchReady;
+	//Wakes the caller when the last thread is done with the batch
+	condition_variable batchDone;
+
+	//The batch being checked, only set while check runs
+	const vector<vector<vector<int>>>* puzzles = nullptr;
+	vector<char>* unique = nullptr;
+	bool useBitboard = false;
+
+	//Goes up by one for every batch so the threads can tell a new one from the one they just did
+	long long batchNumber = 0;
+	//The threads still working on the batch
+	size_t busyThreads = 0;
+	bool stopping = false;
+
+	atomic<size_t> nextPuzzle;
+
+	//Checks every batch handed out after lastBatch, until the pool stops. The batch number is passed in rather than read
+	//when the thread starts, since the first batch may already be handed out by then.
+	void threadLoop(Worker& worker, long long lastBatch);
+
+	//Keeps taking the next puzzle nobody has started on until there are none left
+	void work(Worker& worker);
+
+	void stopThreads();
+};
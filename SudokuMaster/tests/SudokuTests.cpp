@@ -0,0 +1,1099 @@
+/*
+Checks the solvers against answers worked out another way.
+Usage: SudokuTests [engines]...   (all of them if none are given)
+Prints every check that fails and exits with 1 if there was one.
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <cstdlib>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include "../ExactCover/ExactCoverSolver.h"
+#include "../SudokuSolver.h"
+#include "../BitboardSolver.h"
+#include "../ParallelSolver.h"
+#include "../BatchSolver.h"
+#include "../SudokuCore.h"
+#include "../GridGenerator.h"
+#include "../GridTransformer.h"
+#include "../UnavoidableSets.h"
+#include "../ThreadHelper.h"
+#include "../SinglesPropagator.h"
+#include "../CandidateGrid.h"
+
+using namespace std;
+
+static int failures = 0;
+
+static void check(bool passed, const string& what)
+{
+	if (!passed) {
+		cout << "FAILED: " << what << "\n";
+		failures++;
+	}
+}
+
+//Reads a board written row by row, one character per cell, with 0 for an empty cell
+static vector<vector<int>> parse(const string& line, int size = 9)
+{
+	vector<vector<int>> board(size, vector<int>(size));
+	for (int cell = 0; cell < size * size; cell++) {
+		board[cell / size][cell % size] = line[cell] - '0';
+	}
+	return board;
+}
+
+static string toLine(const vector<vector<int>>& board)
+{
+	string line;
+	for (const vector<int>& row : board) {
+		for (int num : row) {
+			line += (char)('0' + num);
+		}
+	}
+	return line;
+}
+
+//The rows, columns and outer squares of a sudoku as lists of cells (row * size + col)
+static vector<vector<int>> classicUnits(int boxRows, int boxCols)
+{
+	int size = boxRows * boxCols;
+	vector<vector<int>> units(size * 3);
+	for (int row = 0; row < size; row++) {
+		for (int col = 0; col < size; col++) {
+			int cell = row * size + col;
+			units[row].push_back(cell);
+			units[size + col].push_back(cell);
+			units[size * 2 + (row / boxRows) * boxRows + col / boxCols].push_back(cell);
+		}
+	}
+	return units;
+}
+
+//Counts the solutions by trying every number in every empty cell in order and checking the units by hand,
+//which shares nothing with the solvers being checked. Only quick enough for small boards or a few empty cells.
+static long long bruteForceCount(int size, const vector<vector<int>>& units, vector<vector<int>> puzzle)
+{
+	vector<vector<int>> cellUnits(size * size);
+	for (size_t unit = 0; unit < units.size(); unit++) {
+		for (int cell : units[unit]) {
+			cellUnits[cell].push_back((int)unit);
+		}
+	}
+
+	auto fits = [&](int cell, int num) {
+		for (int unit : cellUnits[cell]) {
+			for (int other : units[unit]) {
+				if (other != cell && puzzle[other / size][other % size] == num)
+					return false;
+			}
+		}
+		return true;
+	};
+
+	//The givens have to agree with each other too
+	vector<int> empty;
+	for (int cell = 0; cell < size * size; cell++) {
+		int num = puzzle[cell / size][cell % size];
+		if (num == 0)
+			empty.push_back(cell);
+		else if (!fits(cell, num))
+			return 0;
+	}
+
+	long long count = 0;
+	//Plain backtracking without recursion: each empty cell moves on to its next number, or goes back to the one before
+	int depth = 0;
+	while (depth >= 0) {
+		if (depth == (int)empty.size()) {
+			count++;
+			depth--;
+			continue;
+		}
+
+		int cell = empty[depth];
+		int& num = puzzle[cell / size][cell % size];
+		int next = num + 1;
+		num = 0;
+		while (next <= size && !fits(cell, next)) {
+			next++;
+		}
+
+		if (next <= size) {
+			num = next;
+			depth++;
+		}
+		else {
+			depth--;
+		}
+	}
+	return count;
+}
+
+//Returns true if the solution fills every unit with every number and keeps the givens of the puzzle
+static bool solves(int size, const vector<vector<int>>& units, const vector<vector<int>>& puzzle, const vector<vector<int>>& solution)
+{
+	for (const vector<int>& unit : units) {
+		vector<bool> seen(size + 1, false);
+		for (int cell : unit) {
+			int num = solution[cell / size][cell % size];
+			if (num < 1 || num > size || seen[num])
+				return false;
+			seen[num] = true;
+		}
+	}
+
+	for (int row = 0; row < size; row++) {
+		for (int col = 0; col < size; col++) {
+			if (puzzle[row][col] != 0 && puzzle[row][col] != solution[row][col])
+				return false;
+		}
+	}
+	return true;
+}
+
+//Every 9x9 engine has to find the same number of solutions, and the same solutions
+static void testEngines()
+{
+	struct Known
+	{
+		string puzzle;
+		long long solutionCount;
+	};
+	const vector<Known> known = {
+		//A 17 clue puzzle with one solution
+		{ "000000000000003085001020000000507000004000100090000000500000073002010000000040009", 1 },
+		//A well known easy one
+		{ "530070000600195000098000060800060003400803001700020006060000280000419005000080079", 1 },
+		//Two 5s in the first row
+		{ "550070000600195000098000060800060003400803001700020006060000280000419005000080079", 0 },
+		//The solution of the easy one with its top band taken out, and with more taken out, counted by brute force below
+		{ "000000000000000000000000000859761423426853791713924856961537284287419635345286179", -1 },
+		{ "000000000000000000098302567000000000000000000013904856061507284087409635045206179", -1 },
+	};
+	const vector<vector<int>> units = classicUnits(3, 3);
+
+	SudokuSolver algorithmX;
+	BitboardSolver bitboard;
+	ParallelSolver parallel(4);
+	vector<pair<string, SolverEngine*>> engines = { { "algorithmX", &algorithmX }, { "bitboard", &bitboard }, { "parallel", &parallel } };
+
+	for (const Known& test : known) {
+		vector<vector<int>> puzzle = parse(test.puzzle);
+		long long expected = test.solutionCount >= 0 ? test.solutionCount : bruteForceCount(9, units, puzzle);
+
+		//The engines are free to find the solutions in any order
+		vector<string> reference;
+		for (pair<string, SolverEngine*>& engine : engines) {
+			SolutionStore solutions;
+			long long found = engine.second->solve(puzzle, solutions).solutionCount;
+			check(found == expected && (long long)solutions.size() == expected,
+				engine.first + " finds " + to_string(found) + " solutions of " + test.puzzle + ", expected " + to_string(expected));
+			check(engine.second->countSolutions(puzzle).solutionCount == expected, engine.first + " counts the solutions of " + test.puzzle);
+
+			vector<string> lines;
+			for (size_t index = 0; index < solutions.size(); index++) {
+				vector<vector<int>> solution = solutions.board(index);
+				check(solves(9, units, puzzle, solution), engine.first + " gives a wrong solution to " + test.puzzle);
+				lines.push_back(toLine(solution));
+			}
+			sort(lines.begin(), lines.end());
+			if (reference.empty())
+				reference = lines;
+			check(lines == reference, engine.first + " finds different solutions to " + test.puzzle + " than algorithmX");
+
+			//A limited search stops at the limit
+			if (expected > 1) {
+				SolverEngine::SearchResult limited = engine.second->countSolutions(puzzle, 2);
+				check(limited.solutionCount == 2 && limited.limitReached, engine.first + " stops counting at the limit");
+			}
+		}
+	}
+
+	//The parallel solver's threads take turns in a slow progress listener instead of queueing up for it
+	atomic<int> inListener(0);
+	atomic<int> mostInListener(0);
+	atomic<int> reports(0);
+	parallel.progressListener = [&](const vector<vector<int>>&, long long) {
+		int now = ++inListener;
+		if (now > mostInListener)
+			mostInListener = now;
+		reports++;
+		this_thread::sleep_for(chrono::microseconds(200));
+		inListener--;
+	};
+	SolutionStore solutions;
+	parallel.solve(parse("000000000000003005001020000000507000004000100090000000500000073002010000000040009"), solutions, 0, true);
+	parallel.progressListener = nullptr;
+	check(solutions.size() == 252 && reports > 0 && mostInListener == 1, "the parallel solver's progress reports overlap or go missing");
+}
+
+//Every cell the singles fill in has to agree with the only solution, and clashing givens are caught
+static void testSingles()
+{
+	const vector<string> unique = {
+		"000000000000003085001020000000507000004000100090000000500000073002010000000040009",
+		"530070000600195000098000060800060003400803001700020006060000280000419005000080079",
+	};
+	const vector<vector<int>> units = classicUnits(3, 3);
+	SinglesPropagator propagator;
+	BitboardSolver bitboard;
+
+	for (const string& line : unique) {
+		vector<vector<int>> puzzle = parse(line);
+		SolutionStore solutions;
+		bitboard.solve(puzzle, solutions, 1);
+
+		vector<vector<int>> reduced = puzzle;
+		check(propagator.propagate(reduced), "singles find a contradiction in " + line);
+		check(solves(9, units, reduced, solutions.board(0)), "singles fill in a wrong number in " + line);
+	}
+
+	//The easy one needs nothing but singles
+	vector<vector<int>> easy = parse(unique[1]);
+	check(propagator.propagate(easy) && bruteForceCount(9, units, easy) == 1 && toLine(easy).find('0') == string::npos,
+		"singles don't solve the easy puzzle on their own");
+
+	vector<vector<int>> clash = parse("550070000600195000098000060800060003400803001700020006060000280000419005000080079");
+	check(!propagator.propagate(clash), "singles miss two 5s in the first row");
+
+	//The cell to branch on is the first empty one with the fewest numbers left by its units, worked out here from the unit lists
+	auto expectedCell = [](const vector<vector<int>>& modelUnits, const vector<vector<int>>& puzzle) {
+		int best = -1;
+		int bestCount = 10;
+		for (int cell = 0; cell < 81; cell++) {
+			if (puzzle[cell / 9][cell % 9] != 0)
+				continue;
+			vector<bool> used(10, false);
+			for (const vector<int>& unit : modelUnits) {
+				if (find(unit.begin(), unit.end(), cell) == unit.end())
+					continue;
+				for (int other : unit) {
+					used[puzzle[other / 9][other % 9]] = true;
+				}
+			}
+			int count = (int)count_if(used.begin() + 1, used.end(), [](bool isUsed) { return !isUsed; });
+			if (count < bestCount) {
+				best = cell;
+				bestCount = count;
+			}
+		}
+		return best;
+	};
+	ConstraintModel x;
+	x.addDiagonals();
+	SinglesPropagator xPropagator(x);
+	vector<vector<int>> open = parse(unique[0]);
+	const vector<pair<SinglesPropagator*, vector<vector<int>>>> models = { { &propagator, units }, { &xPropagator, x.getUnits() } };
+	for (const pair<SinglesPropagator*, vector<vector<int>>>& model : models) {
+		int row, col;
+		SinglesPropagator::Mask candidates;
+		bool found = model.first->mostConstrainedCell(open, row, col, candidates);
+		int cell = expectedCell(model.second, open);
+		check(found && row * 9 + col == cell, "the most constrained cell is " + to_string(row * 9 + col) + ", expected " + to_string(cell));
+	}
+	int row, col;
+	SinglesPropagator::Mask candidates;
+	check(!propagator.mostConstrainedCell(easy, row, col, candidates), "a full puzzle has an empty cell to branch on");
+}
+
+//Eliminating a number from the peers of a cell takes it from exactly the cells that share a row, column or outer square with it,
+//and the logged eliminations can be undone
+static void testCandidates()
+{
+	for (int cell = 0; cell < 81; cell += 7) {
+		int x = cell % 9;
+		int y = cell / 9;
+		int num = cell % 9 + 1;
+		CandidateGrid grid;
+		grid.fillAll();
+		grid.eliminateFromPeers(x, y, num);
+
+		bool right = true;
+		for (int other = 0; other < 81; other++) {
+			int x1 = other % 9;
+			int y1 = other / 9;
+			bool peer = x1 == x || y1 == y || (x1 / 3 == x / 3 && y1 / 3 == y / 3);
+			right = right && grid.has(x1, y1, num) != peer && grid.toList(x1, y1).size() == (peer ? 8u : 9u);
+		}
+		check(right, "eliminating " + to_string(num) + " from the peers of cell " + to_string(cell));
+	}
+
+	//Only a cell with more than one candidate counts
+	CandidateGrid grid;
+	grid.clearAll();
+	grid.add(4, 7, 3);
+	check(!grid.hasMultipleCandidates(), "a grid with one candidate has a cell with more than one");
+	grid.add(8, 8, 1);
+	grid.add(8, 8, 9);
+	check(grid.hasMultipleCandidates() && grid.toList(8, 8) == vector<int>{ 1, 9 }, "a cell with two candidates is missed");
+
+	//The logged operations change the grid the same way, only write down the cells they change, and undo back to each mark
+	auto sameMasks = [](const CandidateGrid& a, const CandidateGrid& b) {
+		for (int cell = 0; cell < 81; cell++) {
+			if (a.get(cell % 9, cell / 9) != b.get(cell % 9, cell / 9))
+				return false;
+		}
+		return true;
+	};
+	CandidateGrid plain;
+	plain.fillAll();
+	CandidateGrid logged = plain;
+	vector<CandidateGrid> before;
+	vector<size_t> marks;
+	for (int step = 0; step < 6; step++) {
+		int x = (step * 4) % 9;
+		int y = (step * 7) % 9;
+		int num = step + 1;
+		before.push_back(logged);
+		marks.push_back(logged.trailMark());
+		plain.eliminateFromPeers(x, y, num);
+		plain.clear(x, y);
+		logged.eliminateFromPeersLogged(x, y, num);
+		logged.clearLogged(x, y);
+		check(sameMasks(plain, logged), "the logged operations change the grid differently at step " + to_string(step));
+
+		//The first time a cell is written down since the mark it has to be with the mask it had at the mark, and it has to have changed
+		bool onlyChanges = true;
+		vector<bool> seen(81, false);
+		for (size_t entry = marks.back(); entry < logged.getTrail().size(); entry++) {
+			const CandidateGrid::TrailEntry& change = logged.getTrail()[entry];
+			if (!seen[change.cell]) {
+				int x1 = change.cell % 9;
+				int y1 = change.cell / 9;
+				onlyChanges = onlyChanges && before.back().get(x1, y1) == change.mask && logged.get(x1, y1) != change.mask;
+				seen[change.cell] = true;
+			}
+		}
+		check(onlyChanges, "the trail has the wrong old masks at step " + to_string(step));
+	}
+	while (!marks.empty()) {
+		logged.undo(marks.back());
+		check(sameMasks(logged, before.back()) && logged.trailMark() == marks.back(), "undoing to a mark doesn't give back the grid at that mark");
+		marks.pop_back();
+		before.pop_back();
+	}
+}
+
+//The batch mode writes one line per puzzle, in the order of the input, and skips blank lines and comments
+static void testBatch()
+{
+	const string easy = "530070000600195000098000060800060003400803001700020006060000280000419005000080079";
+	const string easySolution = "534678912672195348198342567859761423426853791713924856961537284287419635345286179";
+	const string open = "000000000000000000000000000859761423426853791713924856961537284287419635345286179";
+
+	string dotted = easy;
+	replace(dotted.begin(), dotted.end(), '0', '.');
+	string clash = easy;
+	clash[1] = '5';
+
+	stringstream input;
+	input << "# a comment\n" << easy << "\n\n" << dotted << "\n" << open << "\n" << clash << "\n" << "12345\n" << easy.substr(0, 80) + "x\n";
+
+	//More than one thread, so the results have to be put back in order
+	BatchSolver batch(3);
+	stringstream output;
+	BatchSolver::Statistics stats = batch.run(input, output);
+
+	vector<string> lines;
+	string line;
+	while (getline(output, line)) {
+		lines.push_back(line);
+	}
+	const vector<string> expected = { "unique " + easySolution, "unique " + easySolution, "", "none", "invalid", "invalid" };
+	check(lines.size() == expected.size(), "the batch mode writes " + to_string(lines.size()) + " lines for 6 puzzles");
+	for (size_t index = 0; index < lines.size() && index < expected.size(); index++) {
+		if (index == 2) {
+			//Any of the solutions can come first
+			vector<vector<int>> solution = parse(lines[index].substr(lines[index].find(' ') + 1));
+			check(lines[index].rfind("multiple ", 0) == 0 && solves(9, classicUnits(3, 3), parse(open), solution), "the batch mode writes " + lines[index] + " for " + open);
+		}
+		else {
+			check(lines[index] == expected[index], "the batch mode writes " + lines[index] + " for line " + to_string(index + 1) + ", expected " + expected[index]);
+		}
+	}
+	check(stats.puzzles == 6 && stats.unique == 2 && stats.multiple == 1 && stats.none == 1 && stats.invalid == 2, "the batch statistics are off");
+}
+
+//Listing the solutions one at a time gives the same solutions as finding them all at once,
+//and stopping half way leaves the solver as good as new
+static void testEnumeration()
+{
+	const string open = "000000000000000000098302567000000000000000000013904856061507284087409635045206179";
+	const string easy = "530070000600195000098000060800060003400803001700020006060000280000419005000080079";
+	SudokuSolver solver;
+
+	SolutionStore all;
+	solver.solve(parse(open), all);
+	vector<string> expected;
+	for (size_t index = 0; index < all.size(); index++) {
+		expected.push_back(toLine(all.board(index)));
+	}
+
+	solver.startEnumeration(parse(open));
+	vector<string> listed;
+	vector<vector<int>> solution;
+	while (solver.nextSolution(solution)) {
+		listed.push_back(toLine(solution));
+	}
+	check(listed == expected, "listing the solutions one at a time gives " + to_string(listed.size()) + " of " + to_string(expected.size()));
+	check(!solver.nextSolution(solution), "a finished enumeration keeps going");
+
+	//Stop after a few and start on another puzzle, and then interrupt that one with a plain solve
+	solver.startEnumeration(parse(open));
+	for (int count = 0; count < 3; count++) {
+		solver.nextSolution(solution);
+	}
+	solver.stopEnumeration();
+	solver.startEnumeration(parse(easy));
+	check(solver.nextSolution(solution) && !solver.nextSolution(solution), "the easy puzzle lists other than one solution after a stopped enumeration");
+	solver.startEnumeration(parse(open));
+	solver.nextSolution(solution);
+	check(solver.countSolutions(parse(open)).solutionCount == (long long)expected.size(), "counting drops the enumeration in progress cleanly");
+}
+
+//The packed boards come back out as they went in, also after they have gone to a temporary file
+static void testStore()
+{
+	const vector<string> boards = {
+		"534678912672195348198342567859761423426853791713924856961537284287419635345286179",
+		"123456789456789123789123456214365897365897214897214365531642978642978531978531642",
+	};
+	SolutionStore store;
+	for (int round = 0; round < 50; round++) {
+		store.add(parse(boards[round % 2]));
+	}
+	SolutionStore more;
+	more.add(parse(boards[1]));
+	store.append(more);
+
+	bool same = store.size() == 51;
+	for (size_t index = 0; index < store.size() && same; index++) {
+		const string& expected = boards[index == 50 ? 1 : index % 2];
+		same = toLine(store.board(index)) == expected && store.get(index, 8, 8) == expected[80] - '0' && store.get(index, 4, 3) == expected[39] - '0';
+	}
+	check(same, "the solution store gives back other boards than went in");
+	store.clear();
+	check(store.empty() && store.size() == 0, "a cleared store still has boards");
+
+	//The 252 solutions of this one make plenty of different boards to tell apart
+	vector<vector<int>> puzzle = parse("000000000000003005001020000000507000004000100090000000500000073002010000000040009");
+	SudokuSolver solver;
+	SolutionStore inMemory;
+	solver.solve(puzzle, inMemory);
+
+	SolutionStore spilled;
+	spilled.setMemoryLimit(SolutionStore::bytesPerBoard * 10);
+	for (size_t index = 0; index < inMemory.size(); index++) {
+		spilled.add(inMemory.board(index));
+		//Reading in between adding has to keep working as the file grows
+		check(spilled.board(index / 2) == inMemory.board(index / 2), "a spilled board reads back wrong while adding");
+	}
+	check(spilled.spilled(), "the store went over its memory limit without spilling");
+	same = spilled.size() == inMemory.size();
+	for (size_t index = 0; index < inMemory.size() && same; index++) {
+		same = spilled.board(index) == inMemory.board(index) && spilled.get(index, 2, 7) == inMemory.get(index, 2, 7);
+	}
+	check(same, "a spilled board reads back wrong");
+
+	//Appending a spilled store to another and the other way around
+	SolutionStore joined;
+	joined.setMemoryLimit(SolutionStore::bytesPerBoard * 7);
+	joined.append(spilled);
+	joined.append(inMemory);
+	same = joined.size() == inMemory.size() * 2;
+	for (size_t index = 0; index < joined.size() && same; index++) {
+		same = joined.board(index) == inMemory.board(index % inMemory.size());
+	}
+	check(same, "an appended board reads back wrong");
+
+	spilled.clear();
+	check(!spilled.spilled() && spilled.empty(), "clearing the store doesn't drop the temporary file");
+
+	//The parallel solver joins its subpuzzles in the same order whether they spill or not
+	ParallelSolver parallel(4);
+	SolutionStore limited;
+	limited.setMemoryLimit(SolutionStore::bytesPerBoard * 50);
+	parallel.solve(puzzle, limited);
+	check(limited.spilled(), "the parallel solver's solutions didn't spill");
+	SolutionStore unlimited;
+	parallel.solve(puzzle, unlimited);
+	same = limited.size() == unlimited.size() && limited.size() == inMemory.size();
+	for (size_t index = 0; index < limited.size() && same; index++) {
+		same = limited.board(index) == unlimited.board(index);
+	}
+	check(same, "the parallel solver finds other solutions, or in another order, when they spill");
+}
+
+//A grid with boxes of BoxSize x BoxSize built from a pattern, with its first row and column taken out.
+//Every one of those cells is forced by the other line through it, so the grid is the only solution.
+//An empty grid has to be filled in correctly too.
+template <int BoxSize>
+static void checkPatternGrid()
+{
+	const int size = BoxSize * BoxSize;
+	const string name = to_string(size) + "x" + to_string(size);
+	vector<vector<int>> grid(size, vector<int>(size));
+	for (int row = 0; row < size; row++) {
+		for (int col = 0; col < size; col++) {
+			grid[row][col] = ((row % BoxSize) * BoxSize + row / BoxSize + col) % size + 1;
+		}
+	}
+	const vector<vector<int>> units = classicUnits(BoxSize, BoxSize);
+	check(solves(size, units, grid, grid), "the " + name + " pattern isn't a grid");
+
+	vector<vector<int>> puzzle = grid;
+	for (int index = 0; index < size; index++) {
+		puzzle[0][index] = 0;
+		puzzle[index][0] = 0;
+	}
+	BasicSudokuSolver<Board<BoxSize, BoxSize>> solver;
+	BasicSolutionStore<Board<BoxSize, BoxSize>> solutions;
+	check(solver.solve(puzzle, solutions).solutionCount == 1 && solutions.board(0) == grid, "the " + name + " puzzle has other solutions than its grid");
+
+	vector<vector<int>> empty(size, vector<int>(size));
+	solutions.clear();
+	solver.solve(empty, solutions, 1);
+	check(solutions.size() == 1 && solves(size, units, empty, solutions.board(0)), "the empty " + name + " grid is filled in wrong");
+}
+
+//The classic puzzle on the other board sizes, against the brute force counter
+static void testSizes()
+{
+	//Every 4x4 grid
+	BasicSudokuSolver<Board<2, 2>> solver4;
+	vector<vector<int>> empty4(4, vector<int>(4));
+	check(solver4.countSolutions(empty4).solutionCount == 288, "there are 288 4x4 grids");
+	check(bruteForceCount(4, classicUnits(2, 2), empty4) == 288, "the brute force counter finds 288 4x4 grids");
+
+	//6x6 grids with the first row given: 28200960 grids over the 720 ways to write the first row
+	BasicSudokuSolver<Board<2, 3>> solver6;
+	vector<vector<int>> puzzle6(6, vector<int>(6));
+	puzzle6[0] = { 1, 2, 3, 4, 5, 6 };
+	check(solver6.countSolutions(puzzle6).solutionCount == 28200960 / 720, "there are 39168 6x6 grids with a given first row");
+
+	BasicSolutionStore<Board<2, 3>> solutions6;
+	solver6.solve(puzzle6, solutions6, 100);
+	check(solutions6.size() == 100, "the 6x6 search stops after 100 solutions");
+	for (size_t index = 0; index < solutions6.size(); index++) {
+		check(solves(6, classicUnits(2, 3), puzzle6, solutions6.board(index)), "a 6x6 solution breaks a rule");
+	}
+
+	checkPatternGrid<4>();
+	checkPatternGrid<5>();
+}
+
+//Solves the empty grid of the model, takes out the top two rows and counts the solutions with the solver and the brute force counter
+template <int BoxRows, int BoxCols>
+static long long checkModel(const BasicConstraintModel<Board<BoxRows, BoxCols>>& model, const string& name)
+{
+	const int size = BoxRows * BoxCols;
+	BasicSudokuSolver<Board<BoxRows, BoxCols>> solver(model);
+	vector<vector<int>> empty(size, vector<int>(size));
+	BasicSolutionStore<Board<BoxRows, BoxCols>> grids;
+	solver.solve(empty, grids, 1);
+	check(grids.size() == 1 && solves(size, model.getUnits(), empty, grids.board(0)), "the solver finds no " + name + " grid");
+	if (grids.empty())
+		return 0;
+
+	vector<vector<int>> puzzle = grids.board(0);
+	puzzle[0].assign(size, 0);
+	puzzle[1].assign(size, 0);
+	long long expected = bruteForceCount(size, model.getUnits(), puzzle);
+	check(expected >= 1, "the " + name + " grid isn't a solution of itself with two rows taken out");
+	check(solver.countSolutions(puzzle).solutionCount == expected, name + " solution count doesn't match the brute force count");
+	return expected;
+}
+
+//X-sudoku, windoku and jigsaw, against the brute force counter
+static void testVariants()
+{
+	check(ConstraintModel().getUnits() == classicUnits(3, 3), "the classic model has other units than the rows, columns and outer squares");
+
+	ConstraintModel x;
+	x.addDiagonals();
+	ConstraintModel windoku;
+	windoku.addWindows();
+
+	//The outer squares with cells that hold the same number in this grid swapped between them, so the grid is still a solution
+	const vector<vector<int>> grid = parse("534678912672195348198342567859761423426853791713924856961537284287419635345286179");
+	vector<vector<int>> regions(9, vector<int>(9));
+	for (int row = 0; row < 9; row++) {
+		for (int col = 0; col < 9; col++) {
+			regions[row][col] = (row / 3) * 3 + col / 3;
+		}
+	}
+	//The 8s of the top left and top middle squares, and the 5s of the bottom middle and bottom right squares
+	swap(regions[2][2], regions[0][5]);
+	swap(regions[6][3], regions[7][8]);
+	ConstraintModel jigsaw = ConstraintModel::jigsaw(regions);
+	check(jigsaw.getUnits().size() == 27 && solves(9, jigsaw.getUnits(), grid, grid), "the jigsaw model has other units than the regions");
+
+	const vector<pair<string, ConstraintModel*>> models = { { "X-sudoku", &x }, { "windoku", &windoku }, { "jigsaw", &jigsaw } };
+	for (const pair<string, ConstraintModel*>& model : models) {
+		long long expected = checkModel<3, 3>(*model.second, model.first);
+		if (model.second != &jigsaw) {
+			//The extra units have to rule out some of the classic solutions
+			SolutionStore grids;
+			SudokuSolver(*model.second).solve(vector<vector<int>>(9, vector<int>(9)), grids, 1);
+			vector<vector<int>> puzzle = grids.board(0);
+			puzzle[0].assign(9, 0);
+			puzzle[1].assign(9, 0);
+			check(SudokuSolver().countSolutions(puzzle).solutionCount >= expected, "the classic rules don't allow every " + model.first + " solution");
+		}
+	}
+
+	//All three on a 4x4 board, where the brute force counter can go through every grid.
+	//The jigsaw swaps the 2s of the top squares of 1234/3412/2143/4321, so it has at least that grid.
+	BasicConstraintModel<Board<2, 2>> x4;
+	x4.addDiagonals();
+	BasicConstraintModel<Board<2, 2>> windoku4;
+	windoku4.addWindows();
+	BasicConstraintModel<Board<2, 2>> jigsaw4 = BasicConstraintModel<Board<2, 2>>::jigsaw({
+		{ 0, 1, 1, 1 },
+		{ 0, 0, 1, 0 },
+		{ 2, 2, 3, 3 },
+		{ 2, 2, 3, 3 } });
+	vector<vector<int>> empty4(4, vector<int>(4));
+	for (const BasicConstraintModel<Board<2, 2>>* model : { &x4, &windoku4, &jigsaw4 }) {
+		long long expected = bruteForceCount(4, model->getUnits(), empty4);
+		check(expected > 0 && BasicSudokuSolver<Board<2, 2>>(*model).countSolutions(empty4).solutionCount == expected, "4x4 variant grid count");
+	}
+
+	//Regions that aren't one cell per number are turned down
+	auto throws = [](const vector<vector<int>>& badRegions) {
+		try {
+			ConstraintModel::jigsaw(badRegions);
+		}
+		catch (const invalid_argument&) {
+			return true;
+		}
+		return false;
+	};
+	vector<vector<int>> uneven = regions;
+	uneven[0][0] = 1;
+	check(throws(uneven), "a jigsaw with a region of 8 cells and one of 10 is accepted");
+	vector<vector<int>> outside = regions;
+	outside[4][4] = 9;
+	check(throws(outside), "a jigsaw with a region number past the size is accepted");
+
+	bool unitThrows = false;
+	try {
+		ConstraintModel().addUnit({ 0, 1, 2, 3, 4, 5, 6, 7, 7 });
+	}
+	catch (const invalid_argument&) {
+		unitThrows = true;
+	}
+	check(unitThrows, "a unit with a cell in it twice is accepted");
+}
+
+//The exact cover library on problems that aren't sudokus
+static void testExactCover()
+{
+	//Knuth's example from the dancing links paper, its one solution is rows 0, 3 and 4
+	ExactCoverSolver knuth(7, { { 2, 4, 5 }, { 0, 3, 6 }, { 1, 2, 5 }, { 0, 3 }, { 1, 6 }, { 3, 4, 6 } });
+	vector<vector<int>> found;
+	ExactCoverSolver::SearchResult result = knuth.solve([&](const vector<int>& rows) {
+		found.push_back(rows);
+		sort(found.back().begin(), found.back().end());
+		return true;
+	});
+	check(result.solutionCount == 1 && found == vector<vector<int>>{ { 0, 3, 4 } }, "Knuth's example has other solutions than rows 0, 3 and 4");
+
+	check(!knuth.start({ 0, 2 }), "overlapping given rows are accepted");
+	check(knuth.start({ 3 }) && knuth.next() && !knuth.next(), "Knuth's example with row 3 given has other than one solution");
+	knuth.stop();
+
+	//N queens: every rank and file exactly once (primary), every diagonal at most once (secondary)
+	auto queens = [](int n) {
+		vector<vector<int>> rows;
+		for (int rank = 0; rank < n; rank++) {
+			for (int file = 0; file < n; file++) {
+				rows.push_back({ rank, n + file, n * 2 + rank + file, n * 2 + (n * 2 - 1) + rank - file + n - 1 });
+			}
+		}
+		return ExactCoverSolver(n * 2, rows, (n * 2 - 1) * 2);
+	};
+	check(queens(4).countSolutions().solutionCount == 2, "4 queens can be placed other than 2 ways");
+	ExactCoverSolver eight = queens(8);
+	check(eight.countSolutions().solutionCount == 92, "8 queens can be placed other than 92 ways");
+
+	//The limits stop the search and the matrix is as good as new afterwards
+	ExactCoverSolver::SearchResult limited = eight.countSolutions(10);
+	check(limited.solutionCount == 10 && limited.limitReached, "the solution limit doesn't stop the 8 queens");
+	limited = eight.countSolutions(0, 50);
+	check(limited.nodes <= 50 && limited.limitReached, "the node limit doesn't stop the 8 queens");
+	check(eight.countSolutions().solutionCount == 92, "the 8 queens matrix isn't restored after a limited search");
+}
+
+//Generated puzzles have exactly one solution, which is the complete board they were made from, whichever way they are made
+static void testGenerator()
+{
+	struct Setup
+	{
+		string name;
+		SudokuCore::Engine engine;
+		unsigned removalThreads;
+	};
+	const vector<Setup> setups = {
+		{ "algorithmX", SudokuCore::Engine::algorithmX, 1 },
+		{ "bitboard", SudokuCore::Engine::bitboard, 1 },
+		{ "parallelAlgorithmX", SudokuCore::Engine::parallelAlgorithmX, 1 },
+		{ "algorithmX with 4 removal threads", SudokuCore::Engine::algorithmX, 4 },
+	};
+	const vector<vector<int>> units = classicUnits(3, 3);
+
+	BitboardSolver checker;
+	for (const Setup& setup : setups) {
+		srand(7);
+		SudokuCore core;
+		core.setEngine(setup.engine);
+		core.setRemovalThreads(setup.removalThreads);
+		for (int index = 0; index < 10; index++) {
+			int difficulty = index % 3 + 1;
+			core.createPuzzle(difficulty);
+			const vector<vector<int>>& puzzle = core.getPuzzle();
+			check(solves(9, units, puzzle, core.getCompleteBoard()), setup.name + " made a complete board that breaks a rule or doesn't fit its puzzle");
+
+			SolutionStore solutions;
+			checker.solve(puzzle, solutions, 2);
+			check(solutions.size() == 1 && solutions.board(0) == core.getCompleteBoard(), setup.name + " made a puzzle that doesn't solve to just its complete board");
+
+			//The shuffled puzzle is just as unique, and its complete board is shuffled with it
+			vector<vector<int>> before = puzzle;
+			check(core.shufflePuzzle(), setup.name + " puzzle can't be shuffled");
+			check(core.getPuzzle() != before && solves(9, units, core.getPuzzle(), core.getCompleteBoard()), setup.name + " puzzle doesn't fit its complete board after shuffling");
+			check(checker.countSolutions(core.getPuzzle(), 2).solutionCount == 1, setup.name + " puzzle isn't unique after shuffling");
+
+			//At the hardest difficulty every given is needed
+			if (difficulty == 3) {
+				bool needed = true;
+				vector<vector<int>> fewer = puzzle;
+				for (int cell = 0; cell < 81 && needed; cell++) {
+					int& num = fewer[cell / 9][cell % 9];
+					if (num == 0)
+						continue;
+					int given = num;
+					num = 0;
+					needed = checker.countSolutions(fewer, 2).solutionCount == 2;
+					num = given;
+				}
+				check(needed, setup.name + " left a given in a difficulty 3 puzzle that could be taken out");
+			}
+		}
+	}
+
+	//There is nothing to shuffle before a puzzle is created or set, and a set one shuffles like a created one
+	SudokuCore fresh;
+	check(!fresh.shufflePuzzle() && fresh.getCompleteBoard() == vector<vector<int>>(9, vector<int>(9)), "a core without a puzzle shuffles");
+	const vector<vector<int>> easy = parse("530070000600195000098000060800060003400803001700020006060000280000419005000080079");
+	const vector<vector<int>> easySolution = parse("534678912672195348198342567859761423426853791713924856961537284287419635345286179");
+	fresh.setPuzzle(easy, easySolution);
+	check(fresh.shufflePuzzle() && solves(9, units, fresh.getPuzzle(), fresh.getCompleteBoard())
+		&& checker.countSolutions(fresh.getPuzzle(), 2).solutionCount == 1, "a set puzzle doesn't shuffle into a unique one that fits its complete board");
+
+	//Neither the engine nor the number of removal threads changes the puzzles. The first setup takes clues out incrementally
+	//on one solver, the second checks every removal from scratch, the third checks them speculatively on a pool.
+	vector<vector<string>> made;
+	for (const Setup& setup : { setups[0], setups[1], Setup{ "algorithmX with 3 removal threads", SudokuCore::Engine::algorithmX, 3 } }) {
+		srand(11);
+		SudokuCore core;
+		core.setEngine(setup.engine);
+		core.setRemovalThreads(setup.removalThreads);
+		made.emplace_back();
+		for (int index = 0; index < 5; index++) {
+			core.createPuzzle(3);
+			made.back().push_back(toLine(core.getPuzzle()));
+		}
+		check(made.back() == made.front(), setup.name + " makes other puzzles than algorithmX");
+	}
+}
+
+//Every generated grid follows the rules, and the same seed gives the same grids
+static void testGrids()
+{
+	const vector<vector<int>> units = classicUnits(3, 3);
+	const vector<vector<int>> empty(9, vector<int>(9));
+	GridGenerator generator(5);
+	GridGenerator again(5);
+	GridGenerator other(6);
+	vector<vector<int>> grid;
+	vector<vector<int>> repeat;
+	vector<vector<int>> different;
+	int same = 0;
+	for (int index = 0; index < 200; index++) {
+		generator.generate(grid);
+		again.generate(repeat);
+		other.generate(different);
+		check(solves(9, units, empty, grid), "a generated grid breaks a rule: " + toLine(grid));
+		check(grid == repeat, "the same seed gives different grids");
+		same += grid == different;
+	}
+	check(same < 200, "different seeds give the same grids");
+
+	//Watching the grid being built gives the same grid, and the placements add up to it
+	vector<int> watched(81);
+	generator.seed(9);
+	generator.placementListener = [&](int cell, int num) { watched[cell] = num; };
+	generator.generate(grid);
+	again.seed(9);
+	again.generate(repeat);
+	check(grid == repeat && toLine(grid) == toLine(vector<vector<int>>{ watched }), "the placement listener changes the grid or misses placements");
+}
+
+//A transformed puzzle has as many solutions as the original, and a transformed solution solves the transformed puzzle
+static void testTransformer()
+{
+	const vector<string> puzzles = {
+		"000000000000003085001020000000507000004000100090000000500000073002010000000040009",
+		"000000000000003005001020000000507000004000100090000000500000073002010000000040009",
+		"000000000000000085001020000000507000004000100090000000500000073002010000000040009",
+	};
+	const vector<vector<int>> units = classicUnits(3, 3);
+
+	SudokuSolver solver;
+	GridTransformer transformer(12345);
+	int moved = 0;
+	for (const string& line : puzzles) {
+		vector<vector<int>> puzzle = parse(line);
+		SolutionStore solutions;
+		long long expected = solver.solve(puzzle, solutions).solutionCount;
+
+		for (int index = 0; index < 20; index++) {
+			transformer.next();
+			vector<vector<int>> transformed;
+			transformer.apply(puzzle, transformed);
+			check(solver.countSolutions(transformed).solutionCount == expected, "a transformation of " + line + " has a different solution count");
+			moved += transformed != puzzle;
+
+			vector<vector<int>> transformedSolution;
+			transformer.apply(solutions.board(0), transformedSolution);
+			check(solves(9, units, transformed, transformedSolution), "the transformed solution doesn't solve the transformed puzzle");
+
+			//Both ways of storing the board get the same transformation
+			uint8_t cells[81];
+			uint8_t transformedCells[81];
+			for (int cell = 0; cell < 81; cell++) {
+				cells[cell] = (uint8_t)puzzle[cell / 9][cell % 9];
+			}
+			transformer.apply(cells, transformedCells);
+			bool same = true;
+			for (int cell = 0; cell < 81; cell++) {
+				same = same && transformedCells[cell] == transformed[cell / 9][cell % 9];
+			}
+			check(same, "the two apply functions transform differently");
+		}
+	}
+	check(moved > 50, "the transformations leave the puzzle as it was " + to_string(60 - moved) + " times out of 60");
+}
+
+//Taking clues out of a unique puzzle one at a time with the clues kept in the matrix gives the same answers
+//as counting the solutions of every puzzle from scratch
+static void testClues()
+{
+	GridGenerator generator(3);
+	vector<vector<int>> grid;
+	generator.generate(grid);
+
+	//The cells in the order they are tried, the clues are given the other way around so the next one to try is on top
+	vector<int> order(81);
+	for (int cell = 0; cell < 81; cell++) {
+		order[cell] = (cell * 37) % 81;
+	}
+
+	SudokuSolver solver;
+	BitboardSolver reference;
+	vector<vector<int>> puzzle = grid;
+	vector<int> toTry(order.rbegin(), order.rend());
+	for (int cell : toTry) {
+		check(solver.giveClue(cell / 9, cell % 9, grid[cell / 9][cell % 9]), "a clue of a complete grid clashes");
+	}
+	check(!solver.giveClue(0, 0, grid[0][0]) && !solver.giveClue(0, 0, grid[0][0] % 9 + 1), "a clue that clashes with the others is given");
+
+	//The clues that couldn't be taken out sit on top of the ones still to try
+	vector<int> failed;
+	int agreed = 0;
+	while (!toTry.empty()) {
+		int cell = toTry.back();
+		int row = cell / 9;
+		int col = cell % 9;
+		for (size_t index = 0; index < failed.size(); index++) {
+			solver.ungiveClue();
+		}
+		solver.ungiveClue();
+		toTry.pop_back();
+		for (int kept : failed) {
+			solver.giveClue(kept / 9, kept % 9, grid[kept / 9][kept % 9]);
+		}
+		check(solver.getClueCount() == (int)(toTry.size() + failed.size()), "the solver has the wrong number of clues");
+
+		puzzle[row][col] = 0;
+		bool unique = reference.countSolutions(puzzle, 2).solutionCount == 1;
+		agreed += solver.hasOtherSolution(row, col, grid[row][col]) != unique;
+		if (!unique) {
+			puzzle[row][col] = grid[row][col];
+			failed.push_back(cell);
+			solver.giveClue(row, col, grid[row][col]);
+		}
+	}
+	check(agreed == 81, "hasOtherSolution disagrees with counting from scratch for " + to_string(81 - agreed) + " cells");
+	check(failed.size() >= 17 && reference.countSolutions(puzzle, 2).solutionCount == 1, "the clues left aren't a unique puzzle");
+
+	//With every clue taken back out the solver is as good as new
+	while (solver.getClueCount() > 0) {
+		solver.ungiveClue();
+	}
+	check(solver.countSolutions(puzzle).solutionCount == 1, "the solver doesn't solve the puzzle after its clues are taken out");
+}
+
+//Whenever the unavoidable sets turn a removal down, the puzzle really would have more than one solution without that clue
+static void testUnavoidableSets()
+{
+	GridGenerator generator(21);
+	BitboardSolver reference;
+	int turnedDown = 0;
+	for (int round = 0; round < 10; round++) {
+		vector<vector<int>> grid;
+		generator.generate(grid);
+		UnavoidableSets sets;
+		sets.build(grid);
+		//Every set has at least four cells, so no clue of the complete grid is the last of a set
+		bool noneLast = true;
+		for (int cell = 0; cell < 81; cell++) {
+			noneLast = noneLast && !sets.isLastClue(cell % 9, cell / 9);
+		}
+		check(noneLast, "a clue of the complete grid " + toLine(grid) + " is the last of an unavoidable set");
+
+		//The cells holding either of a pair of numbers can always swap them, so the last of those clues can't go
+		UnavoidableSets pair = sets;
+		int last = -1;
+		for (int cell = 0; cell < 81; cell++) {
+			int num = grid[cell / 9][cell % 9];
+			if (num == round % 9 + 1 || num == (round + 4) % 9 + 1) {
+				if (last >= 0)
+					pair.removeClue(last % 9, last / 9);
+				last = cell;
+			}
+		}
+		check(pair.isLastClue(last % 9, last / 9), "the cells holding a pair of numbers aren't an unavoidable set in " + toLine(grid));
+
+		vector<vector<int>> puzzle = grid;
+		bool sound = true;
+		for (int step = 0; step < 81; step++) {
+			int cell = (step * 29 + round * 7) % 81;
+			int x = cell % 9;
+			int y = cell / 9;
+			puzzle[y][x] = 0;
+			bool unique = reference.countSolutions(puzzle, 2).solutionCount == 1;
+			if (sets.isLastClue(x, y)) {
+				sound = sound && !unique;
+				turnedDown++;
+			}
+
+			if (unique)
+				sets.removeClue(x, y);
+			else
+				puzzle[y][x] = grid[y][x];
+		}
+		check(sound, "the unavoidable sets turned down a removal that keeps " + toLine(grid) + " unique");
+	}
+	check(turnedDown > 0, "the unavoidable sets never turned a removal down");
+}
+
+//0 threads means as many as the hardware has, every index gets run exactly once, and only real numbers are thread counts
+static void testThreads()
+{
+	check(ThreadHelper::resolveThreadCount(0) >= 1 && ThreadHelper::resolveThreadCount(3) == 3, "the thread count is resolved wrong");
+
+	vector<atomic<int>> runs(5);
+	ThreadHelper::runOnThreads(runs.size(), [&](size_t index) { runs[index]++; });
+	bool once = true;
+	for (atomic<int>& count : runs) {
+		once = once && count == 1;
+	}
+	check(once, "runOnThreads doesn't run every index once");
+	ThreadHelper::runOnThreads(0, [&](size_t) { runs[0]++; });
+	check(runs[0] == 1, "runOnThreads runs something with no threads");
+
+	//Only whole numbers up to the maximum are thread counts
+	unsigned parsed = 7;
+	check(ThreadHelper::parseThreadCount("0", parsed) && parsed == 0 && ThreadHelper::parseThreadCount("12", parsed) && parsed == 12, "a thread count is read wrong");
+	for (const string& text : vector<string>{ "", "-1", "abc", "3x", " 2", "+2", "99999999999999999999", to_string(ThreadHelper::maxThreadCount + 1) }) {
+		check(!ThreadHelper::parseThreadCount(text, parsed) && parsed == 12, "\"" + text + "\" is taken as a thread count");
+	}
+}
+
+//Every engine stops solving at the limit, and only algorithmX can carry on from there
+static void testCoreSolve()
+{
+	const vector<vector<int>> open = parse("000000000000000000098302567000000000000000000013904856061507284087409635045206179");
+	const vector<pair<string, SudokuCore::Engine>> engines = {
+		{ "algorithmX", SudokuCore::Engine::algorithmX },
+		{ "bitboard", SudokuCore::Engine::bitboard },
+		{ "parallelAlgorithmX", SudokuCore::Engine::parallelAlgorithmX },
+	};
+	for (const pair<string, SudokuCore::Engine>& engine : engines) {
+		SudokuCore core;
+		core.setEngine(engine.second);
+		core.solve(open, false);
+		while (core.findNextSolution()) {
+		}
+		check(core.allSolutionsFound() && core.getSolutions().size() == 580, engine.first + " finds " + to_string(core.getSolutions().size()) + " of the 580 solutions");
+
+		//algorithmX always finds two up front, the others exactly as many as allowed
+		core.solve(open, false, 5);
+		size_t found = core.getSolutions().size();
+		check(!core.allSolutionsFound() && found == (engine.second == SudokuCore::Engine::algorithmX ? 2u : 5u), engine.first + " doesn't stop at the limit");
+		check(core.findNextSolution() == (engine.second == SudokuCore::Engine::algorithmX) && !core.allSolutionsFound(), engine.first + " carries on after the limit the wrong way");
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	vector<string> chosen(argv + 1, argv + argc);
+	auto wanted = [&](const string& name) {
+		return chosen.empty() || find(chosen.begin(), chosen.end(), name) != chosen.end();
+	};
+
+	if (wanted("exactcover"))
+		testExactCover();
+	if (wanted("engines"))
+		testEngines();
+	if (wanted("singles"))
+		testSingles();
+	if (wanted("candidates"))
+		testCandidates();
+	if (wanted("threads"))
+		testThreads();
+	if (wanted("batch"))
+		testBatch();
+	if (wanted("enumeration"))
+		testEnumeration();
+	if (wanted("coresolve"))
+		testCoreSolve();
+	if (wanted("store"))
+		testStore();
+	if (wanted("sizes"))
+		testSizes();
+	if (wanted("variants"))
+		testVariants();
+	if (wanted("generator"))
+		testGenerator();
+	if (wanted("grids"))
+		testGrids();
+	if (wanted("transformer"))
+		testTransformer();
+	if (wanted("clues"))
+		testClues();
+	if (wanted("unavoidable"))
+		testUnavoidableSets();
+
+	cout << (failures == 0 ? "All checks passed\n" : to_string(failures) + " checks failed\n");
+	return failures == 0 ? 0 : 1;
+}